@@ -0,0 +1,415 @@
+/**
+ * @file    bench_main.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Standalone microbenchmark runner for the edge and debounce paths.
+ * @license MIT
+ *
+ * @details
+ * Measures the cost per sample of every hot path over four input patterns
+ * (constant, alternating, random, bursty bounce) and prints one JSON
+ * document to stdout, so results can be archived and compared between
+ * releases.
+ *
+ * Host build (timer: rdtsc on x86, clock_gettime on other POSIX hosts),
+ * with the same modules as the `edge_bench` target in CMakeLists.txt:
+ * @code
+ * cc -O2 Benchmark/bench_main.c "Edge Detector/"*.c "Debounce Signal/"*.c \
+ *    "Debounced Edge/"*.c "Quadrature Decoder/"*.c "Schmitt Trigger/"*.c \
+ *    -o edge_bench
+ * ./edge_bench > results.json
+ * @endcode
+ *
+ * Cortex-M build: compile the same sources for the target, retarget
+ * `printf()` to a UART/SWO and call `bench_run()` from the application;
+ * DWT->CYCCNT is used automatically (see Common/cycle_counter.h). Define
+ * `BENCH_NO_MAIN` to leave `main()` to the application and `BENCH_SAMPLES`
+ * to fit the buffers into RAM.
+ *
+ * Every case is repeated BENCH_REPEAT times and the fastest run is
+ * reported, which filters out interrupts and cache warm-up.
+ */
+
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../Common/cycle_counter.h"
+#include "../Debounce Signal/debounce.h"
+#include "../Debounce Signal/debounce_port.h"
+#include "../Debounced Edge/debounced_edge.h"
+#include "../Edge Detector/edge_array.h"
+#include "../Edge Detector/edge_bank.h"
+#include "../Edge Detector/edge_detector.h"
+#include "../Edge Detector/edge_glitch.h"
+#include "../Edge Detector/edge_simd.h"
+#include "../Quadrature Decoder/quadrature.h"
+#include "../Schmitt Trigger/schmitt.h"
+
+#ifndef BENCH_SAMPLES
+#if defined(__arm__) && !defined(__aarch64__)
+#define BENCH_SAMPLES 1024u
+#else
+#define BENCH_SAMPLES 65536u
+#endif
+#endif
+
+#ifndef BENCH_REPEAT
+#define BENCH_REPEAT 15u
+#endif
+
+/** Lanes driven by the port-wide cases (EdgeBank64, DebouncePort, EdgeArray). */
+#define BENCH_LANES 64u
+
+typedef enum {
+    BENCH_CONSTANT = 0,
+    BENCH_ALTERNATING,
+    BENCH_RANDOM,
+    BENCH_BURSTY,
+    BENCH_PATTERN_COUNT
+} BenchPattern;
+
+static const char *const bench_pattern_names[BENCH_PATTERN_COUNT] = {
+    "constant", "alternating", "random", "bursty"
+};
+
+static uint8_t  bench_bytes[BENCH_SAMPLES];
+static uint8_t  bench_bits[BENCH_SAMPLES / 8u + 1u];
+static uint64_t bench_words[BENCH_SAMPLES];
+static uint16_t bench_adc[BENCH_SAMPLES];
+
+/* Results are accumulated here so the compiler cannot drop the work. */
+static volatile uint64_t bench_sink;
+
+static uint32_t bench_rng_state = 0x12345678u;
+
+static uint32_t bench_rand(void)
+{
+    /* xorshift32: deterministic across runs and targets */
+    uint32_t x = bench_rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    bench_rng_state = x;
+    return x;
+}
+
+/**
+ * @brief Fills the sample buffers with one pattern.
+ * Bursty: long stable levels, each change preceded by a short random bounce.
+ */
+static void bench_fill(BenchPattern pattern)
+{
+    uint8_t level = 0u;
+    uint32_t next_change = 500u;
+
+    bench_rng_state = 0x12345678u;
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        uint8_t s;
+        switch (pattern) {
+        case BENCH_CONSTANT:    s = 1u; break;
+        case BENCH_ALTERNATING: s = (uint8_t)(i & 1u); break;
+        case BENCH_RANDOM:      s = (uint8_t)(bench_rand() & 1u); break;
+        default:
+            if (i >= next_change) {
+                level ^= 1u;
+                next_change = i + 200u + (bench_rand() % 800u);
+            }
+            s = (next_change - i <= 16u) ? (uint8_t)(bench_rand() & 1u) : level;
+            break;
+        }
+        bench_bytes[i] = s;
+    }
+
+    for (uint32_t i = 0; i < sizeof(bench_bits); i++) bench_bits[i] = 0u;
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        bench_bits[i / 8u] |= (uint8_t)(bench_bytes[i] << (i % 8u));
+
+    /* ADC view: the level plus noise that crosses the hysteresis band. */
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        bench_adc[i] = (uint16_t)((bench_bytes[i] ? 3000u : 1000u) + (bench_rand() % 256u));
+
+    /* Each lane sees the same pattern at a different phase. */
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t w = 0u;
+        for (uint32_t lane = 0; lane < BENCH_LANES; lane++)
+            w |= (uint64_t)bench_bytes[(i + lane * 37u) % BENCH_SAMPLES] << lane;
+        bench_words[i] = w;
+    }
+}
+
+typedef void (*BenchFn)(void);
+
+/* --- Cases ---------------------------------------------------------------- */
+
+static void bench_edge_update(void)
+{
+    EdgeDetector det;
+    uint32_t acc = 0u;
+    edge_init(&det, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc += (uint32_t)edge_update(&det, bench_bytes[i]);
+    bench_sink += acc;
+}
+
+static void bench_edge_both(void)
+{
+    EdgeDetector det;
+    uint32_t acc = 0u;
+    edge_init(&det, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc += edge_both(&det, bench_bytes[i]);
+    bench_sink += acc;
+}
+
+static void bench_edge_update_buffer(void)
+{
+    EdgeDetector det;
+    edge_init(&det, 0u);
+    bench_sink += edge_update_buffer(&det, bench_bytes, BENCH_SAMPLES, 0, 0u);
+}
+
+static void bench_edge_update_packed(void)
+{
+    EdgeDetector det;
+    edge_init(&det, 0u);
+    bench_sink += edge_update_packed(&det, bench_bits, BENCH_SAMPLES, 0, 0u);
+}
+
+static void bench_edge_glitch_update_packed(void)
+{
+    EdgeDetector det;
+    EdgeGlitch g;
+    edge_init(&det, 0u);
+    edge_glitch_init(&g, &det, 4u);
+    bench_sink += edge_glitch_update_packed(&g, bench_bits, BENCH_SAMPLES, 0, 0u);
+}
+
+static void bench_schmitt_process_packed(void)
+{
+    static uint8_t bits[BENCH_SAMPLES / 8u + 1u];
+    Schmitt s;
+    schmitt_init(&s, 1500u, 2500u, 0u);
+    bench_sink += schmitt_process_packed(&s, bench_adc, BENCH_SAMPLES, bits);
+    bench_sink += bits[0];
+}
+
+static void bench_debounce_update(void)
+{
+    Debounce d;
+    uint32_t acc = 0u;
+    debounce_init(&d, 0, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc += debounce_update(&d, bench_bytes[i]);
+    bench_sink += acc;
+}
+
+static void bench_debounce_update_at(void)
+{
+    Debounce d;
+    uint32_t acc = 0u;
+    debounce_init_ticks(&d, 3u, 0u, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc += debounce_update_at(&d, bench_bytes[i], i);
+    bench_sink += acc;
+}
+
+static void bench_debounce_integrator(void)
+{
+    Debounce d;
+    uint32_t acc = 0u;
+    debounce_init_integrator(&d, 4u, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc += debounce_update(&d, bench_bytes[i]);
+    bench_sink += acc;
+}
+
+static void bench_debounce_majority(void)
+{
+    Debounce d;
+    uint32_t acc = 0u;
+    debounce_init_majority(&d, 5u, 8u, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc += debounce_update(&d, bench_bytes[i]);
+    bench_sink += acc;
+}
+
+static void bench_debounce_update_packed(void)
+{
+    Debounce d;
+    debounce_init(&d, 0, 0u);
+    bench_sink += debounce_update_packed(&d, bench_bits, BENCH_SAMPLES);
+}
+
+static void bench_edge_bank64_update(void)
+{
+    EdgeBank64 bank;
+    uint64_t acc = 0u;
+    edge_bank64_init(&bank, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc ^= edge_bank64_update(&bank, bench_words[i]);
+    bench_sink += acc;
+}
+
+static void bench_edge_array_update_word(void)
+{
+    static uint64_t prev[1];
+    static uint32_t rises[BENCH_LANES], falls[BENCH_LANES];
+    EdgeArray arr;
+    uint64_t acc = 0u;
+    edge_array_init(&arr, prev, rises, falls, BENCH_LANES);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc ^= edge_array_update_word(&arr, 0u, bench_words[i]);
+    bench_sink += acc;
+}
+
+static void bench_edge_array_update_word_rate(void)
+{
+    static uint64_t prev[1];
+    static uint32_t rises[BENCH_LANES], falls[BENCH_LANES];
+    static EdgeRateSlot slots[BENCH_LANES];
+    static EdgeRateTop top[8], last_top[8];
+    EdgeArray arr;
+    EdgeRate rate;
+    uint64_t acc = 0u;
+    edge_array_init(&arr, prev, rises, falls, BENCH_LANES);
+    edge_rate_init(&rate, slots, BENCH_LANES, top, last_top, 8u, 256u, 0u);
+    edge_array_attach_rate(&arr, &rate);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        acc ^= edge_array_update_word(&arr, 0u, bench_words[i]);
+        edge_rate_advance(&rate, i);
+    }
+    bench_sink += acc;
+}
+
+static void bench_debounce_port_update(void)
+{
+    DebouncePort port;
+    uint64_t acc = 0u;
+    debounce_port_init(&port, 4u, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc ^= debounce_port_update(&port, bench_words[i]);
+    bench_sink += acc;
+}
+
+static void bench_debounce_then_edge(void)
+{
+    Debounce d;
+    EdgeDetector det;
+    uint32_t acc = 0u;
+    debounce_init_ticks(&d, 3u, 0u, 0u);
+    edge_init(&det, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc += (uint32_t)edge_update(&det, debounce_update_at(&d, bench_bytes[i], i));
+    bench_sink += acc;
+}
+
+static void bench_debounced_edge_update_at(void)
+{
+    DebouncedEdge de;
+    uint32_t acc = 0u;
+    debounced_edge_init_ticks(&de, 3u, 0u, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc += (uint32_t)debounced_edge_update_at(&de, bench_bytes[i], i);
+    bench_sink += acc;
+}
+
+static void bench_quadrature_bank_update(void)
+{
+    QuadratureBank bank;
+    uint32_t acc = 0u;
+    quadrature_bank_init(&bank, QUADRATURE_BANK_MAX, 0u);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+        acc ^= quadrature_bank_update(&bank, (uint32_t)bench_words[i]);
+    bench_sink += acc;
+}
+
+typedef struct {
+    const char *name;
+    BenchFn fn;
+    uint32_t lanes;     /**< Signals processed per sample. */
+} BenchCase;
+
+static const BenchCase bench_cases[] = {
+    { "edge_update",              bench_edge_update,             1u },
+    { "edge_both",                bench_edge_both,               1u },
+    { "edge_update_buffer",       bench_edge_update_buffer,      1u },
+    { "edge_update_packed",       bench_edge_update_packed,      1u },
+    { "edge_glitch_update_packed", bench_edge_glitch_update_packed, 1u },
+    { "schmitt_process_packed",   bench_schmitt_process_packed,  1u },
+    { "debounce_update",          bench_debounce_update,         1u },
+    { "debounce_update_at",       bench_debounce_update_at,      1u },
+    { "debounce_update_packed",   bench_debounce_update_packed,  1u },
+    { "debounce_integrator",      bench_debounce_integrator,     1u },
+    { "debounce_majority",        bench_debounce_majority,       1u },
+    { "edge_bank64_update",       bench_edge_bank64_update,      BENCH_LANES },
+    { "edge_array_update_word",   bench_edge_array_update_word,  BENCH_LANES },
+    { "edge_array_update_word_rate", bench_edge_array_update_word_rate, BENCH_LANES },
+    { "debounce_port_update",     bench_debounce_port_update,    BENCH_LANES },
+    { "debounce_then_edge",       bench_debounce_then_edge,      1u },
+    { "debounced_edge_update_at", bench_debounced_edge_update_at, 1u },
+    { "quadrature_bank_update",   bench_quadrature_bank_update,  QUADRATURE_BANK_MAX },
+};
+
+#define BENCH_CASE_COUNT (sizeof(bench_cases) / sizeof(bench_cases[0]))
+
+static uint64_t bench_measure(BenchFn fn)
+{
+    uint64_t best = UINT64_MAX;
+    fn(); /* warm-up */
+    for (uint32_t r = 0; r < BENCH_REPEAT; r++) {
+        cycle_count_t start = cycle_counter_now();
+        fn();
+        uint64_t elapsed = cycle_counter_elapsed(start, cycle_counter_now());
+        if (elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+/**
+ * @brief Runs every case over every pattern and prints the JSON report.
+ */
+void bench_run(void)
+{
+    int first = 1;
+
+    cycle_counter_init();
+    printf("{\n  \"suite\": \"c-library-signals\",\n");
+    printf("  \"unit\": \"%s\",\n", CYCLE_COUNTER_UNIT);
+    printf("  \"simd_kernel\": \"%s\",\n", edge_simd_kernel_name());
+#if defined(EDGE_DETECTOR_USE_LUT)
+    printf("  \"edge_update_impl\": \"lut\",\n");
+#else
+    printf("  \"edge_update_impl\": \"branch\",\n");
+#endif
+    printf("  \"samples\": %u,\n", (unsigned)BENCH_SAMPLES);
+    printf("  \"repeat\": %u,\n", (unsigned)BENCH_REPEAT);
+    printf("  \"results\": [\n");
+
+    for (unsigned p = 0; p < BENCH_PATTERN_COUNT; p++) {
+        bench_fill((BenchPattern)p);
+        for (unsigned c = 0; c < BENCH_CASE_COUNT; c++) {
+            uint64_t total = bench_measure(bench_cases[c].fn);
+            double per_sample = (double)total /
+                                ((double)BENCH_SAMPLES * (double)bench_cases[c].lanes);
+            printf("%s    {\"name\": \"%s\", \"pattern\": \"%s\", \"lanes\": %u, "
+                   "\"total\": %llu, \"per_signal_sample\": %.4f}",
+                   first ? "" : ",\n", bench_cases[c].name, bench_pattern_names[p],
+                   (unsigned)bench_cases[c].lanes, (unsigned long long)total, per_sample);
+            first = 0;
+        }
+    }
+    printf("\n  ]\n}\n");
+}
+
+#ifndef BENCH_NO_MAIN
+int main(void)
+{
+    bench_run();
+    return 0;
+}
+#endif
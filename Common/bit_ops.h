@@ -0,0 +1,119 @@
+/**
+ * @file    bit_ops.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Portable bit manipulation helpers shared by the signal modules.
+ * @license MIT
+ *
+ * @details
+ * Thin wrappers over compiler builtins (GCC/Clang) with plain C fallbacks,
+ * so the bulk and packed-bit paths compile on any toolchain.
+ */
+
+#ifndef BIT_OPS_H
+#define BIT_OPS_H
+
+#include <stdint.h>
+#include <string.h>
+
+/* Byte order, for the word-at-a-time loads. Unknown targets use the byte loop. */
+#if !defined(BIT_OPS_LITTLE_ENDIAN) && !defined(BIT_OPS_BIG_ENDIAN)
+#  if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#    define BIT_OPS_LITTLE_ENDIAN 1
+#  elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#    define BIT_OPS_BIG_ENDIAN 1
+#  elif defined(_MSC_VER) || defined(__ARMEL__) || defined(__LITTLE_ENDIAN__)
+#    define BIT_OPS_LITTLE_ENDIAN 1
+#  endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of set bits in a 64-bit word.
+ */
+static inline unsigned bit_popcount64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (unsigned)((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+/**
+ * @brief Index of the lowest set bit.
+ * @note Undefined for x == 0.
+ */
+static inline unsigned bit_ctz64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctzll(x);
+#else
+    unsigned n = 0u;
+    while (!(x & 1u)) { x >>= 1; n++; }
+    return n;
+#endif
+}
+
+/**
+ * @brief Index of the highest set bit.
+ * @note Undefined for x == 0.
+ */
+static inline unsigned bit_msb64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - (unsigned)__builtin_clzll(x);
+#else
+    unsigned n = 0u;
+    while (x >>= 1) n++;
+    return n;
+#endif
+}
+
+/**
+ * @brief Loads up to 8 bytes as a little-endian word (byte 0 → bits 0..7).
+ * @param p Source bytes.
+ * @param len Number of bytes to load (0..8); missing bytes read as zero.
+ *
+ * @details
+ * A full word is one unaligned load (plus a byte swap on big-endian
+ * targets); only the partial tail word of a buffer takes the byte loop.
+ */
+static inline uint64_t bit_load_le64(const uint8_t *p, unsigned len)
+{
+    uint64_t w = 0u;
+#if defined(BIT_OPS_LITTLE_ENDIAN) || (defined(BIT_OPS_BIG_ENDIAN) && (defined(__GNUC__) || defined(__clang__)))
+    if (len == 8u) {
+        memcpy(&w, p, sizeof(w));
+#  if defined(BIT_OPS_BIG_ENDIAN)
+        w = __builtin_bswap64(w);
+#  endif
+        return w;
+    }
+#endif
+    for (unsigned i = 0; i < len; i++) {
+        w |= (uint64_t)p[i] << (8u * i);
+    }
+    return w;
+}
+
+/**
+ * @brief Mask of the lowest n bits (n = 0..64).
+ */
+static inline uint64_t bit_mask64(unsigned n)
+{
+    return (n >= 64u) ? ~(uint64_t)0u : (((uint64_t)1u << n) - 1u);
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* BIT_OPS_H */
@@ -0,0 +1,106 @@
+/**
+ * @file    clib_barrier.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Acquire/release accesses for the lock-free paths on any toolchain.
+ * @license MIT
+ *
+ * @details
+ * The SPSC event queue and the counter seqlock publish plain data through
+ * one 32-bit index or sequence word. With GCC/Clang the accesses map to
+ * `__atomic` builtins. Other toolchains get a volatile access plus
+ * `CLIB_BARRIER()`, which must stop both the compiler and the CPU from
+ * moving memory accesses across it:
+ * - IAR: `__DMB()`,
+ * - Arm Compiler 5: `__schedule_barrier()` + `__dmb()`,
+ * - MSVC: `_ReadWriteBarrier()` (x86/x64), `__dmb()` (ARM/ARM64).
+ *
+ * Define `CLIB_BARRIER()` yourself for any other compiler.
+ */
+
+#ifndef CLIB_BARRIER_H
+#define CLIB_BARRIER_H
+
+#include <stdint.h>
+
+#if !defined(__GNUC__) && !defined(__clang__) && !defined(CLIB_BARRIER)
+#  if defined(__ICCARM__)
+#    include <intrinsics.h>
+#    define CLIB_BARRIER() __DMB()
+#  elif defined(__CC_ARM)
+#    define CLIB_BARRIER() do { __schedule_barrier(); __dmb(0xF); __schedule_barrier(); } while (0)
+#  elif defined(_MSC_VER)
+#    include <intrin.h>
+#    if defined(_M_ARM64)
+#      define CLIB_BARRIER() __dmb(_ARM64_BARRIER_ISH)
+#    elif defined(_M_ARM)
+#      define CLIB_BARRIER() __dmb(_ARM_BARRIER_ISH)
+#    else
+#      define CLIB_BARRIER() _ReadWriteBarrier()
+#    endif
+#  else
+#    error "clib_barrier.h: unknown compiler, define CLIB_BARRIER() (compiler + memory barrier)"
+#  endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Loads a word; later accesses are not moved before it.
+ */
+static inline uint32_t clib_load_acquire32(const volatile uint32_t *p)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#else
+    uint32_t v = *p;
+    CLIB_BARRIER();
+    return v;
+#endif
+}
+
+/**
+ * @brief Stores a word; earlier accesses are not moved after it.
+ */
+static inline void clib_store_release32(volatile uint32_t *p, uint32_t v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+#else
+    CLIB_BARRIER();
+    *p = v;
+#endif
+}
+
+/**
+ * @brief Earlier accesses are not moved after later stores.
+ */
+static inline void clib_fence_release(void)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+#else
+    CLIB_BARRIER();
+#endif
+}
+
+/**
+ * @brief Earlier loads are not moved after later accesses.
+ */
+static inline void clib_fence_acquire(void)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#else
+    CLIB_BARRIER();
+#endif
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* CLIB_BARRIER_H */
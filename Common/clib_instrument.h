@@ -0,0 +1,158 @@
+/**
+ * @file    clib_instrument.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Compile-time optional cycle statistics for the hot paths.
+ * @license MIT
+ *
+ * @details
+ * With `CLIB_INSTRUMENTATION` defined (for the library and all its users,
+ * CMake option of the same name), EdgeDetector, Debounce and the edge banks
+ * get a `stats` pointer. A ClibStats attached there records, per update
+ * call, the cycles spent (min / max / total, see cycle_counter.h for the
+ * unit) and, separately, how often and how long the edge hooks ran
+ * (callbacks, queue, timing, history).
+ *
+ * Without the macro the `stats` members and the `*_attach_stats()`
+ * functions do not exist and the probe macros expand to nothing, so the
+ * structures and hot paths carry no instrumentation at all.
+ *
+ * Typical usage:
+ * @code
+ * #if defined(CLIB_INSTRUMENTATION)
+ * static ClibStats button_stats;
+ * cycle_counter_init();
+ * clib_stats_init(&button_stats);
+ * edge_attach_stats(&button, &button_stats);
+ * ...
+ * printf("avg %lu max %lu\n", (unsigned long)clib_stats_average(&button_stats),
+ *        (unsigned long)button_stats.max_cycles);
+ * #endif
+ * @endcode
+ *
+ * One ClibStats may be shared by several instances to get group totals.
+ * Updates are not atomic: attach one ClibStats per thread of execution.
+ */
+
+#ifndef CLIB_INSTRUMENT_H
+#define CLIB_INSTRUMENT_H
+
+#include <stdint.h>
+
+#if defined(CLIB_INSTRUMENTATION)
+#include "cycle_counter.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct ClibStats
+ * @brief Cycle statistics of one instance (or group of instances).
+ *
+ * @var ClibStats::calls
+ *      Instrumented update calls.
+ * @var ClibStats::total_cycles
+ *      Cycles of all calls, hooks included.
+ * @var ClibStats::callbacks
+ *      Edge hook dispatches (one per edge, or per bank update with edges).
+ * @var ClibStats::callback_cycles
+ *      Cycles spent in the hooks.
+ * @var ClibStats::min_cycles
+ *      Cheapest call (UINT32_MAX before the first call).
+ * @var ClibStats::max_cycles
+ *      Most expensive call.
+ * @var ClibStats::max_callback_cycles
+ *      Most expensive hook dispatch.
+ */
+typedef struct ClibStats {
+    uint64_t calls;
+    uint64_t total_cycles;
+    uint64_t callbacks;
+    uint64_t callback_cycles;
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint32_t max_callback_cycles;
+} ClibStats;
+
+/**
+ * @brief Clears the statistics.
+ * @param s Pointer to the ClibStats instance.
+ */
+static inline void clib_stats_init(ClibStats *s)
+{
+    if (!s) return;
+    s->calls = 0u;
+    s->total_cycles = 0u;
+    s->callbacks = 0u;
+    s->callback_cycles = 0u;
+    s->min_cycles = UINT32_MAX;
+    s->max_cycles = 0u;
+    s->max_callback_cycles = 0u;
+}
+
+/**
+ * @brief Adds one call of `cycles` cycles.
+ */
+static inline void clib_stats_record(ClibStats *s, uint64_t cycles)
+{
+    uint32_t c = (cycles > UINT32_MAX) ? UINT32_MAX : (uint32_t)cycles;
+    s->calls++;
+    s->total_cycles += cycles;
+    if (c < s->min_cycles) s->min_cycles = c;
+    if (c > s->max_cycles) s->max_cycles = c;
+}
+
+/**
+ * @brief Adds one hook dispatch of `cycles` cycles.
+ */
+static inline void clib_stats_record_callback(ClibStats *s, uint64_t cycles)
+{
+    uint32_t c = (cycles > UINT32_MAX) ? UINT32_MAX : (uint32_t)cycles;
+    s->callbacks++;
+    s->callback_cycles += cycles;
+    if (c > s->max_callback_cycles) s->max_callback_cycles = c;
+}
+
+/**
+ * @brief Mean cycles per call (0 before the first call).
+ * @param s Pointer to the ClibStats instance.
+ */
+static inline uint64_t clib_stats_average(const ClibStats *s)
+{
+    return (s && s->calls) ? s->total_cycles / s->calls : 0u;
+}
+
+/**
+ * @def CLIB_STATS_BEGIN(stats, t)
+ * @brief Declares `t` and starts a measurement if `stats` is attached.
+ * @def CLIB_STATS_END(stats, t)
+ * @brief Records the call started with CLIB_STATS_BEGIN.
+ * @def CLIB_STATS_CALLBACK_END(stats, t)
+ * @brief Records the hook dispatch started with CLIB_STATS_BEGIN.
+ */
+#if defined(CLIB_INSTRUMENTATION)
+
+/* Differences are taken in the counter's width: a 32-bit CYCCNT may wrap. */
+#define CLIB_STATS_BEGIN(stats, t) \
+    cycle_count_t t = (stats) ? cycle_counter_now() : 0u
+#define CLIB_STATS_END(stats, t) \
+    do { if (stats) clib_stats_record((stats), cycle_counter_elapsed((t), cycle_counter_now())); } while (0)
+#define CLIB_STATS_CALLBACK_END(stats, t) \
+    do { if (stats) clib_stats_record_callback((stats), cycle_counter_elapsed((t), cycle_counter_now())); } while (0)
+
+#else
+
+#define CLIB_STATS_BEGIN(stats, t)          ((void)0)
+#define CLIB_STATS_END(stats, t)            ((void)0)
+#define CLIB_STATS_CALLBACK_END(stats, t)   ((void)0)
+
+#endif /* CLIB_INSTRUMENTATION */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* CLIB_INSTRUMENT_H */
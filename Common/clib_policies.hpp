@@ -0,0 +1,64 @@
+/**
+ * @file    clib_policies.hpp
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Compile-time policies shared by the C++17 wrappers.
+ * @license MIT
+ *
+ * @details
+ * Policies are empty classes (or classes holding only what the feature
+ * needs) that the detector templates inherit from, so a disabled feature
+ * occupies no storage and generates no code.
+ */
+
+#ifndef CLIB_POLICIES_HPP
+#define CLIB_POLICIES_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+namespace clib {
+
+/** @brief Callback policy: no callback (zero size, calls vanish). */
+struct NoCallback {
+    template <typename... Args>
+    constexpr void operator()(Args &&...) const noexcept {}
+};
+
+/**
+ * @brief Callback policy calling a function known at compile time.
+ * @tparam Fn Function called with the event (direct call, no pointer stored).
+ */
+template <auto Fn>
+struct Callback {
+    template <typename... Args>
+    void operator()(Args &&...args) const { Fn(static_cast<Args &&>(args)...); }
+};
+
+/** @brief Counter policy: no edge counters (zero size). */
+struct NoCounters {};
+
+/**
+ * @brief Counter policy: rising and falling edge counters.
+ * @tparam T Counter type.
+ */
+template <typename T = std::uint32_t>
+struct Counters {
+    T rises = 0;    /**< Rising edges. */
+    T falls = 0;    /**< Falling edges. */
+};
+
+namespace detail {
+
+template <typename T>
+struct is_counting : std::false_type {};
+
+template <typename T>
+struct is_counting<Counters<T>> : std::true_type {};
+
+} // namespace detail
+
+} // namespace clib
+
+#endif /* CLIB_POLICIES_HPP */
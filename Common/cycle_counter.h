@@ -0,0 +1,131 @@
+/**
+ * @file    cycle_counter.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Portable cycle/tick counter for benchmarks and instrumentation.
+ * @license MIT
+ *
+ * @details
+ * Selects the cheapest monotonic counter of the target:
+ * - Cortex-M3/M4/M7/M33/M55 (`__ARM_ARCH_7M__`, `__ARM_ARCH_7EM__`,
+ *   `__ARM_ARCH_8M_MAIN__`, `__ARM_ARCH_8_1M_MAIN__`): DWT->CYCCNT, in core cycles.
+ * - x86 / x86-64 with GCC/Clang/MSVC: rdtsc, in TSC reference cycles.
+ * - Other POSIX hosts: clock_gettime(CLOCK_MONOTONIC), in nanoseconds.
+ *
+ * Other targets (Cortex-M0, bare-metal RISC-V, ...) have no portable
+ * cycle counter and stop the build: define `CYCLE_COUNTER_CUSTOM` there.
+ *
+ * `CYCLE_COUNTER_UNIT` names the unit for reports. Readings are
+ * `cycle_count_t`, as wide as the counter, and intervals are taken with
+ * `cycle_counter_elapsed()`, which stays exact across a wrap of a 32-bit
+ * counter. Define `CYCLE_COUNTER_CUSTOM` and provide `cycle_counter_now()`
+ * yourself to use another timer (extended to 64 bits).
+ */
+
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(CYCLE_COUNTER_CUSTOM)
+
+#define CYCLE_COUNTER_UNIT "ticks"
+typedef uint64_t cycle_count_t;
+static inline void cycle_counter_init(void) {}
+cycle_count_t cycle_counter_now(void);
+
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || \
+      defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+
+#define CYCLE_COUNTER_UNIT "cycles"
+typedef uint32_t cycle_count_t;
+
+#define _CC_DEMCR       (*(volatile uint32_t *)0xE000EDFCu)
+#define _CC_DWT_CTRL    (*(volatile uint32_t *)0xE0001000u)
+#define _CC_DWT_CYCCNT  (*(volatile uint32_t *)0xE0001004u)
+#define _CC_DWT_LAR     (*(volatile uint32_t *)0xE0001FB0u)
+
+/**
+ * @brief Enables the DWT cycle counter (trace enable + CYCCNTENA).
+ */
+static inline void cycle_counter_init(void)
+{
+    _CC_DEMCR |= (1u << 24);        /* TRCENA */
+    _CC_DWT_LAR = 0xC5ACCE55u;      /* Unlock on cores that need it (M7) */
+    _CC_DWT_CYCCNT = 0u;
+    _CC_DWT_CTRL |= 1u;             /* CYCCNTENA */
+}
+
+/**
+ * @brief Current cycle count (32-bit counter, wraps every 2^32 cycles).
+ */
+static inline cycle_count_t cycle_counter_now(void)
+{
+    return _CC_DWT_CYCCNT;
+}
+
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+#define CYCLE_COUNTER_UNIT "tsc"
+typedef uint64_t cycle_count_t;
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+static inline void cycle_counter_init(void) {}
+
+/**
+ * @brief Current time-stamp counter value.
+ */
+static inline cycle_count_t cycle_counter_now(void)
+{
+    return (cycle_count_t)__rdtsc();
+}
+
+#elif defined(__unix__) || defined(__APPLE__)
+
+#define CYCLE_COUNTER_UNIT "ns"
+typedef uint64_t cycle_count_t;
+
+#include <time.h>
+
+static inline void cycle_counter_init(void) {}
+
+/**
+ * @brief Current monotonic time in nanoseconds.
+ */
+static inline cycle_count_t cycle_counter_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+#else
+
+#error "cycle_counter.h: no cycle counter for this target, define CYCLE_COUNTER_CUSTOM and provide cycle_counter_now()"
+
+#endif
+
+/**
+ * @brief Counts elapsed between two readings, computed in the counter's
+ *        own width (intervals shorter than one wrap are exact).
+ */
+static inline uint64_t cycle_counter_elapsed(cycle_count_t start, cycle_count_t end)
+{
+    return (cycle_count_t)(end - start);
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* CYCLE_COUNTER_H */
@@ -4,6 +4,12 @@
  */
 
 #include "debounce.h"
+#include "../Common/bit_ops.h"
+
+// Out-of-line definition of the hot path, unless the header inlines it
+#if !defined(DEBOUNCE_INLINE)
+#include "debounce_inline.h"
+#endif
 
 void debounce_init(Debounce *d, uint8_t (*time_ref)(void), uint8_t initial_input)
 {
@@ -11,35 +17,83 @@ void debounce_init(Debounce *d, uint8_t (*time_ref)(void), uint8_t initial_input
     d->prev_input    = (initial_input != 0);
     d->stable_output = d->prev_input;
     d->time_ref      = time_ref;
+#if defined(CLIB_INSTRUMENTATION)
+    d->stats         = 0;
+#endif
+    d->changed_at    = 0u;
+    d->settle_ticks  = 0u;
+    d->history       = d->prev_input ? 0xFFFFFFFFu : 0u;
+    d->mode          = DEBOUNCE_MODE_TIME_REF;
+    d->count         = 0u;
+    d->threshold     = 0u;
+    d->window        = 0u;
 }
 
-/**
- * @brief Internal helper: checks time_ref safely.
- * If time_ref is NULL, always returns 1 (immediate acceptance).
- */
-static inline uint8_t _debounce_time_ready(Debounce *d)
+void debounce_init_ticks(Debounce *d, uint32_t settle_ticks, uint8_t initial_input, uint32_t now)
+{
+    if (!d) return;
+    debounce_init(d, 0, initial_input);
+    d->changed_at   = now;
+    d->settle_ticks = settle_ticks;
+}
+
+void debounce_init_integrator(Debounce *d, uint8_t limit, uint8_t initial_input)
+{
+    if (!d) return;
+    debounce_init(d, 0, initial_input);
+    d->mode      = DEBOUNCE_MODE_INTEGRATOR;
+    d->threshold = limit ? limit : 1u;
+    d->count     = d->prev_input ? d->threshold : 0u;
+}
+
+void debounce_init_majority(Debounce *d, uint8_t n, uint8_t m, uint8_t initial_input)
 {
-    if (!d->time_ref) return 1;
-    return d->time_ref();
+    if (!d) return;
+    debounce_init(d, 0, initial_input);
+    if (m == 0u) m = 1u;
+    if (m > DEBOUNCE_MAJORITY_MAX_WINDOW) m = (uint8_t)DEBOUNCE_MAJORITY_MAX_WINDOW;
+    if (n == 0u) n = 1u;
+    if (n > m) n = m;
+    d->mode      = DEBOUNCE_MODE_MAJORITY;
+    d->threshold = n;
+    d->window    = m;
 }
 
-uint8_t debounce_update(Debounce *d, uint8_t input)
+uint8_t debounce_update_packed(Debounce *d, const uint8_t *bits, size_t nbits)
 {
     if (!d) return 0;
-    input = (input != 0); // Normalize input to 0/1
-
-    // Detect change in input
-    if (input != d->prev_input) {
-        d->prev_input = input;
-        // If a time function exists, user can reset timer externally here
-        _debounce_time_ready(d); // harmless call for user-defined reset handling
-        return d->stable_output; // Not yet confirmed
+    if (!bits) return d->stable_output;
+
+    if (d->time_ref || d->mode != DEBOUNCE_MODE_TIME_REF) {
+        // Timing is user-defined or stateful → keep the per-sample contract
+        for (size_t i = 0; i < nbits; i++) {
+            debounce_update(d, (bits[i / 8u] >> (i % 8u)) & 1u);
+        }
+        return d->stable_output;
     }
 
-    // Input unchanged → check timing
-    if (_debounce_time_ready(d)) {
-        d->stable_output = input;
+    uint64_t prev = d->prev_input;
+    for (size_t base = 0; base < nbits; base += 64u) {
+        size_t left = nbits - base;
+        unsigned valid = (left >= 64u) ? 64u : (unsigned)left;
+        uint64_t w = bit_load_le64(bits + base / 8u, (valid + 7u) / 8u);
+
+        // Samples equal to their predecessor confirm their own value
+        uint64_t same = ~(w ^ ((w << 1) | prev)) & bit_mask64(valid);
+        if (same) {
+            d->stable_output = (uint8_t)((w >> bit_msb64(same)) & 1u);
+        }
+        prev = (w >> (valid - 1u)) & 1u;
     }
 
+    d->prev_input = (uint8_t)prev;
     return d->stable_output;
 }
+
+#if defined(CLIB_INSTRUMENTATION)
+void debounce_attach_stats(Debounce *d, ClibStats *stats)
+{
+    if (!d) return;
+    d->stats = stats;
+}
+#endif
@@ -14,12 +14,41 @@
 #ifndef DEBOUNCE_H_
 #define DEBOUNCE_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "../Common/clib_instrument.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @def DEBOUNCE_HOT_API
+ * @brief Linkage of debounce_update() and debounce_update_at().
+ *
+ * Define DEBOUNCE_INLINE (for the library and all its users) to make them
+ * `static inline` in this header; by default they live in debounce.c.
+ */
+#if defined(DEBOUNCE_INLINE)
+#define DEBOUNCE_HOT_API static inline
+#else
+#define DEBOUNCE_HOT_API
+#endif
+
+/**
+ * @enum DebounceMode
+ * @brief Algorithm used by debounce_update() for one instance.
+ */
+typedef enum {
+    DEBOUNCE_MODE_TIME_REF = 0,  /**< Input unchanged and time_ref() ready (default) */
+    DEBOUNCE_MODE_INTEGRATOR,    /**< Saturating up/down counter with hysteresis */
+    DEBOUNCE_MODE_MAJORITY       /**< N-of-M vote over a shift-register window */
+} DebounceMode;
+
+/** @brief Largest N-of-M window (bits of Debounce::history). */
+#define DEBOUNCE_MAJORITY_MAX_WINDOW 32u
+
 /**
  * @struct Debounce
  * @brief Represents one independent debounced signal instance.
@@ -33,11 +62,48 @@ extern "C" {
  * @var Debounce::time_ref
  *      Pointer to the user-defined timing function.
  *      Returns 0 while waiting and 1 when the configured offset time has elapsed.
+ *
+ * @var Debounce::stats
+ *      Optional cycle statistics (only with CLIB_INSTRUMENTATION).
+ *
+ * @var Debounce::changed_at
+ *      Tick of the last raw input change (tick mode, see debounce_update_at()).
+ *
+ * @var Debounce::settle_ticks
+ *      Ticks the input must stay unchanged before it is accepted (tick mode).
+ *
+ * @var Debounce::history
+ *      Last raw samples, newest in bit 0 (majority mode).
+ *
+ * @var Debounce::mode
+ *      DebounceMode of the instance.
+ *
+ * @var Debounce::count
+ *      Integrator value, 0..threshold (integrator mode).
+ *
+ * @var Debounce::threshold
+ *      Integrator limit, or N of the N-of-M vote.
+ *
+ * @var Debounce::window
+ *      M of the N-of-M vote.
+ *
+ * The first three members keep their original order; later members are
+ * appended after them.
  */
 typedef struct {
     uint8_t prev_input;
     uint8_t stable_output;
     uint8_t (*time_ref)(void);
+#if defined(CLIB_INSTRUMENTATION)
+    ClibStats *stats;
+#endif
+    uint32_t changed_at;
+    uint32_t settle_ticks;
+    uint32_t history;
+    uint8_t mode;
+    uint8_t count;
+    uint8_t threshold;
+    uint8_t window;
 } Debounce;
 
 /**
@@ -49,6 +115,51 @@ typedef struct {
  */
 void debounce_init(Debounce *d, uint8_t (*time_ref)(void), uint8_t initial_input);
 
+/**
+ * @brief Initializes a Debounce instance in tick mode.
+ *
+ * @param d Pointer to the Debounce structure.
+ * @param settle_ticks Ticks a new input level must persist before it is accepted.
+ * @param initial_input The current raw input signal (0 or 1) for synchronization.
+ * @param now Current tick (same time base as later debounce_update_at() calls).
+ *
+ * @details
+ * Tick mode replaces the time_ref() callback: each instance stores the tick
+ * of its last input change and its own settle time, so pins can use
+ * different settle times with a single shared timer (or a sample counter).
+ */
+void debounce_init_ticks(Debounce *d, uint32_t settle_ticks, uint8_t initial_input, uint32_t now);
+
+/**
+ * @brief Initializes a Debounce instance as a saturating integrator.
+ *
+ * @param d Pointer to the Debounce structure.
+ * @param limit Integrator limit (1..255, 0 is treated as 1).
+ * @param initial_input The current raw input signal (0 or 1) for synchronization.
+ *
+ * @details
+ * Every high sample counts up and every low sample counts down, saturating
+ * at 0 and `limit`. The output goes high when the counter reaches `limit`
+ * and low when it reaches 0, so isolated glitches only move the counter
+ * and a change needs a net surplus of `limit` samples. No timer is used.
+ */
+void debounce_init_integrator(Debounce *d, uint8_t limit, uint8_t initial_input);
+
+/**
+ * @brief Initializes a Debounce instance as an N-of-M majority vote.
+ *
+ * @param d Pointer to the Debounce structure.
+ * @param n Samples that must agree (clamped to 1..m).
+ * @param m Window length in samples (clamped to 1..DEBOUNCE_MAJORITY_MAX_WINDOW).
+ * @param initial_input The current raw input signal (0 or 1) for synchronization.
+ *
+ * @details
+ * The last `m` samples are kept in a shift register. The output goes high
+ * when at least `n` of them are high, low when at least `n` are low, and
+ * holds otherwise (n > m/2 gives a majority vote with hysteresis).
+ */
+void debounce_init_majority(Debounce *d, uint8_t n, uint8_t m, uint8_t initial_input);
+
 /**
  * @brief Processes a single debounce step for a digital input.
  *
@@ -60,11 +171,65 @@ void debounce_init(Debounce *d, uint8_t (*time_ref)(void), uint8_t initial_input
  * - If the input changes, the module starts waiting for the stable period.
  * - The stable period is defined by the user's time_ref() function.
  * - If no time_ref() is provided (NULL), changes are accepted immediately.
+ * - Instances set up with debounce_init_integrator() or
+ *   debounce_init_majority() use that algorithm instead (integer ops only).
+ */
+DEBOUNCE_HOT_API uint8_t debounce_update(Debounce *d, uint8_t input);
+
+/**
+ * @brief Processes a single debounce step in tick mode.
+ *
+ * @param d Pointer to the Debounce instance (see debounce_init_ticks()).
+ * @param input Raw digital signal (0 or 1).
+ * @param now Monotonic tick counter; wrap-around is handled.
+ * @return uint8_t Debounced (stable) signal.
+ *
+ * @details
+ * - A change of the raw input records `now` as the change time.
+ * - An unchanged input is accepted once (now - changed_at) >= settle_ticks.
+ * - One subtraction and compare per call, no indirect calls; time_ref is ignored.
+ * - Always uses the tick algorithm, whatever the instance's mode.
  */
-uint8_t debounce_update(Debounce *d, uint8_t input);
+DEBOUNCE_HOT_API uint8_t debounce_update_at(Debounce *d, uint8_t input, uint32_t now);
+
+/**
+ * @brief Processes a bit-packed stream of raw samples in one call.
+ *
+ * @param d Pointer to the Debounce instance.
+ * @param bits Packed samples, 1 bit per sample, LSB-first
+ *             (sample i is bit (i % 8) of bits[i / 8]).
+ * @param nbits Number of samples in the stream.
+ * @return uint8_t Debounced (stable) signal after the last sample.
+ *
+ * @details
+ * - Equivalent to calling debounce_update() once per sample.
+ * - Without time_ref() the stream is processed 64 samples at a time:
+ *   the output follows the last sample equal to its predecessor.
+ * - With a time_ref(), or in integrator/majority mode, it is still
+ *   processed once per sample.
+ */
+uint8_t debounce_update_packed(Debounce *d, const uint8_t *bits, size_t nbits);
+
+#if defined(CLIB_INSTRUMENTATION)
+/**
+ * @brief Attaches cycle statistics to a Debounce instance.
+ *
+ * @param d Pointer to the Debounce instance.
+ * @param stats Initialized statistics (see clib_instrument.h), or NULL to detach.
+ *
+ * @details
+ * Records every debounce_update() / debounce_update_at() call.
+ * Only available with CLIB_INSTRUMENTATION; the init functions detach.
+ */
+void debounce_attach_stats(Debounce *d, ClibStats *stats);
+#endif
 
 #ifdef __cplusplus
 }
 #endif
 
+#if defined(DEBOUNCE_INLINE)
+#include "debounce_inline.h"
+#endif
+
 #endif /* DEBOUNCE_H_ */
@@ -0,0 +1,140 @@
+/**
+ * @file debounce.hpp
+ * @author Radmehr
+ * @brief Compile-time specialized debounce for C++17 (v1.0)
+ * @version 1.0
+ * @date 2026-10-14
+ *
+ * @details
+ * clib::Debounce<SettleTicks, OnChange> has the semantics of
+ * debounce_update_at() with the settle time as a template constant, so the
+ * comparison folds into an immediate, and a change callback chosen at
+ * compile time. SettleTicks = 0 behaves like debounce_update() without a
+ * time_ref() (a change is accepted on the second identical sample) and
+ * stores no timestamp at all.
+ *
+ * @code
+ * clib::Debounce<20> key;                          // 20 ticks settle time
+ * bool pressed = key.update(read_pin(), ticks());
+ *
+ * clib::Debounce<0> fast;                          // no timer needed
+ * bool level = fast.update(read_pin());
+ * @endcode
+ *
+ * Existing C state can be loaded with the converting constructor and
+ * written back with export_to().
+ */
+
+#ifndef DEBOUNCE_HPP_
+#define DEBOUNCE_HPP_
+
+#include "debounce.h"
+#include "../Common/clib_policies.hpp"
+
+namespace clib {
+
+namespace detail {
+
+// Change timestamp, only stored when there is a settle time
+template <bool Timed>
+struct DebounceClock {
+    std::uint32_t changed_at = 0;
+};
+
+template <>
+struct DebounceClock<false> {};
+
+} // namespace detail
+
+/**
+ * @brief Debounced signal with compile-time settle time and callback.
+ * @tparam SettleTicks Ticks a new level must persist before it is accepted.
+ * @tparam OnChange Callable invoked as `cb(bool)` when the output changes;
+ *         NoCallback, Callback<fn> or any (preferably empty) functor.
+ */
+template <std::uint32_t SettleTicks, typename OnChange = NoCallback>
+class Debounce : private detail::DebounceClock<(SettleTicks != 0u)>, private OnChange {
+public:
+    /**
+     * @brief Creates a debouncer synchronized with the input.
+     * @param initial_input Current raw input.
+     * @param now Current tick (ignored when SettleTicks is 0).
+     * @param cb Callback instance.
+     */
+    constexpr explicit Debounce(bool initial_input = false, std::uint32_t now = 0u,
+                                OnChange cb = OnChange()) noexcept
+        : OnChange(cb), prev_(initial_input), stable_(initial_input)
+    {
+        if constexpr (SettleTicks != 0u) this->changed_at = now;
+        (void)now;
+    }
+
+    /**
+     * @brief Takes over the state of a C instance.
+     * @param c Initialized C instance (tick mode or without time_ref()).
+     * @param cb Callback instance.
+     */
+    explicit Debounce(const ::Debounce &c, OnChange cb = OnChange()) noexcept
+        : OnChange(cb), prev_(c.prev_input != 0u), stable_(c.stable_output != 0u)
+    {
+        if constexpr (SettleTicks != 0u) this->changed_at = c.changed_at;
+    }
+
+    /**
+     * @brief Processes one sample (same as debounce_update_at()).
+     * @param input Raw input.
+     * @param now Monotonic tick counter; wrap-around is handled.
+     * @return Debounced output.
+     */
+    bool update(bool input, std::uint32_t now)
+    {
+        if (input != prev_) {
+            prev_ = input;
+            if constexpr (SettleTicks != 0u) this->changed_at = now;
+            return stable_; // Not yet confirmed
+        }
+        if constexpr (SettleTicks != 0u) {
+            if (static_cast<std::uint32_t>(now - this->changed_at) < SettleTicks) return stable_;
+        }
+        (void)now;
+
+        if (input != stable_) {
+            stable_ = input;
+            static_cast<OnChange &>(*this)(stable_);
+        }
+        return stable_;
+    }
+
+    /**
+     * @brief Processes one sample without timestamps (SettleTicks = 0 only).
+     * @param input Raw input.
+     * @return Debounced output.
+     */
+    bool update(bool input)
+    {
+        static_assert(SettleTicks == 0u, "timed debounce needs update(input, now)");
+        return update(input, 0u);
+    }
+
+    /** @brief Current debounced output. */
+    constexpr bool output() const noexcept { return stable_; }
+
+    /**
+     * @brief Writes the state into a C instance (tick mode).
+     * @param c C instance; it is switched to tick mode with SettleTicks.
+     */
+    void export_to(::Debounce &c) const noexcept
+    {
+        debounce_init_ticks(&c, SettleTicks, prev_ ? 1u : 0u, 0u);
+        c.stable_output = stable_ ? 1u : 0u;
+        if constexpr (SettleTicks != 0u) c.changed_at = this->changed_at;
+    }
+
+private:
+    bool prev_;
+    bool stable_;
+};
+
+} // namespace clib
+
+#endif /* DEBOUNCE_HPP_ */
@@ -0,0 +1,127 @@
+/**
+ * @file debounce_inline.h
+ * @author Radmehr
+ * @brief Hot-path definitions of the debounce library (v1.1)
+ *
+ * @details
+ * Do not include directly. With DEBOUNCE_INLINE defined this file is pulled
+ * into every user of debounce.h and debounce_update()/debounce_update_at()
+ * become `static inline`; otherwise debounce.c includes it once for the
+ * regular external definitions.
+ */
+
+#ifndef DEBOUNCE_INLINE_H_
+#define DEBOUNCE_INLINE_H_
+
+#include "debounce.h"
+#include "../Common/bit_ops.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Internal helper: checks time_ref safely.
+ * If time_ref is NULL, always returns 1 (immediate acceptance).
+ */
+static inline uint8_t _debounce_time_ready(Debounce *d)
+{
+    if (!d->time_ref) return 1;
+    return d->time_ref();
+}
+
+/**
+ * @brief Internal helper: saturating integrator step (branch-free).
+ */
+static inline uint8_t _debounce_integrate(Debounce *d, uint8_t input)
+{
+    d->count = (uint8_t)(d->count + (input & (d->count < d->threshold)));
+    d->count = (uint8_t)(d->count - (!input & (d->count > 0u)));
+    d->stable_output = (uint8_t)((d->count == d->threshold) |
+                                 (d->stable_output & (d->count != 0u)));
+    return d->stable_output;
+}
+
+/**
+ * @brief Internal helper: N-of-M vote over the sample history (branch-free).
+ */
+static inline uint8_t _debounce_vote(Debounce *d, uint8_t input)
+{
+    d->history = (d->history << 1) | input;
+    uint32_t ones = bit_popcount64(d->history & (uint32_t)bit_mask64(d->window));
+    d->stable_output = (uint8_t)((ones >= d->threshold) |
+                                 (d->stable_output & ((d->window - ones) < d->threshold)));
+    return d->stable_output;
+}
+
+/**
+ * @brief Internal helper: one step of debounce_update() on a 0/1 input.
+ */
+static inline uint8_t _debounce_step(Debounce *d, uint8_t input)
+{
+    // Alternative algorithms (mode is fixed per instance → predictable)
+    if (d->mode != DEBOUNCE_MODE_TIME_REF) {
+        d->prev_input = input;
+        if (d->mode == DEBOUNCE_MODE_INTEGRATOR) return _debounce_integrate(d, input);
+        return _debounce_vote(d, input);
+    }
+
+    // Detect change in input
+    if (input != d->prev_input) {
+        d->prev_input = input;
+        // If a time function exists, user can reset timer externally here
+        _debounce_time_ready(d); // harmless call for user-defined reset handling
+        return d->stable_output; // Not yet confirmed
+    }
+
+    // Input unchanged → check timing
+    if (_debounce_time_ready(d)) {
+        d->stable_output = input;
+    }
+
+    return d->stable_output;
+}
+
+/**
+ * @brief Internal helper: one step of debounce_update_at() on a 0/1 input.
+ */
+static inline uint8_t _debounce_step_at(Debounce *d, uint8_t input, uint32_t now)
+{
+    // Detect change in input → restart the settle period
+    if (input != d->prev_input) {
+        d->prev_input = input;
+        d->changed_at = now;
+        return d->stable_output; // Not yet confirmed
+    }
+
+    // Input unchanged → accept once it has been stable long enough
+    if ((uint32_t)(now - d->changed_at) >= d->settle_ticks) {
+        d->stable_output = input;
+    }
+
+    return d->stable_output;
+}
+
+DEBOUNCE_HOT_API uint8_t debounce_update(Debounce *d, uint8_t input)
+{
+    if (!d) return 0;
+    CLIB_STATS_BEGIN(d->stats, t0);
+    uint8_t out = _debounce_step(d, (uint8_t)(input != 0)); // Normalize input to 0/1
+    CLIB_STATS_END(d->stats, t0);
+    return out;
+}
+
+DEBOUNCE_HOT_API uint8_t debounce_update_at(Debounce *d, uint8_t input, uint32_t now)
+{
+    if (!d) return 0;
+    CLIB_STATS_BEGIN(d->stats, t0);
+    uint8_t out = _debounce_step_at(d, (uint8_t)(input != 0), now); // Normalize input to 0/1
+    CLIB_STATS_END(d->stats, t0);
+    return out;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBOUNCE_INLINE_H_ */
@@ -0,0 +1,48 @@
+/**
+ * @file debounce_port.c
+ * @brief Implementation of the vertical-counter port debounce (v1.0)
+ */
+
+#include "debounce_port.h"
+
+void debounce_port_init(DebouncePort *p, uint8_t samples, uint64_t initial_input)
+{
+    if (!p) return;
+    if (samples == 0u) samples = 1u;
+    if (samples > DEBOUNCE_PORT_MAX_SAMPLES) samples = (uint8_t)DEBOUNCE_PORT_MAX_SAMPLES;
+
+    p->stable_output = initial_input;
+    for (unsigned i = 0; i < DEBOUNCE_PORT_PLANES; i++) {
+        p->planes[i] = 0u;
+    }
+    p->samples = samples;
+}
+
+uint64_t debounce_port_update(DebouncePort *p, uint64_t input)
+{
+    if (!p) return 0;
+
+    // Pins whose raw input disagrees with the stable output
+    uint64_t delta = input ^ p->stable_output;
+
+    // Ripple-carry increment of the disagreeing counters, clear the others
+    uint64_t carry = delta;
+    for (unsigned i = 0; i < DEBOUNCE_PORT_PLANES; i++) {
+        uint64_t plane = p->planes[i];
+        p->planes[i] = (plane ^ carry) & delta;
+        carry &= plane;
+    }
+
+    // Counters equal to the sample count → change confirmed
+    uint64_t reached = delta;
+    for (unsigned i = 0; i < DEBOUNCE_PORT_PLANES; i++) {
+        reached &= ((p->samples >> i) & 1u) ? p->planes[i] : ~p->planes[i];
+    }
+
+    p->stable_output ^= reached;
+    for (unsigned i = 0; i < DEBOUNCE_PORT_PLANES; i++) {
+        p->planes[i] &= ~reached;
+    }
+
+    return p->stable_output;
+}
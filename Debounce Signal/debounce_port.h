@@ -0,0 +1,96 @@
+/**
+ * @file debounce_port.h
+ * @author Radmehr
+ * @brief Vertical-counter debounce for whole GPIO ports (up to 64 pins)
+ * @version 1.0
+ * @date 2026-10-14
+ *
+ * @details
+ * Every pin owns a small counter whose bits are stored "vertically": bit N of
+ * plane P is bit P of pin N's counter. A counter advances while its raw input
+ * differs from the stable output and is cleared as soon as the input agrees
+ * again. When it reaches the configured sample count, the stable output of
+ * that pin toggles. All pins of the port are processed with a handful of
+ * bitwise operations per tick, with no function-pointer calls.
+ *
+ * 8-, 16- and 32-bit ports simply pass their register value; unused upper
+ * bits stay zero.
+ */
+
+#ifndef DEBOUNCE_PORT_H_
+#define DEBOUNCE_PORT_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of counter bit-planes per port.
+ * Limits the sample count to (2^DEBOUNCE_PORT_PLANES - 1).
+ */
+#ifndef DEBOUNCE_PORT_PLANES
+#define DEBOUNCE_PORT_PLANES 4u
+#endif
+
+/** @brief Largest sample count supported by DEBOUNCE_PORT_PLANES. */
+#define DEBOUNCE_PORT_MAX_SAMPLES ((1u << DEBOUNCE_PORT_PLANES) - 1u)
+
+/**
+ * @struct DebouncePort
+ * @brief Debounce state of up to 64 pins sharing one sample count.
+ *
+ * @var DebouncePort::stable_output
+ *      Confirmed stable (debounced) level of every pin, as a mask.
+ *
+ * @var DebouncePort::planes
+ *      Vertical counter bit-planes (plane 0 = least significant bit).
+ *
+ * @var DebouncePort::samples
+ *      Consecutive disagreeing samples required before a pin toggles.
+ */
+typedef struct {
+    uint64_t stable_output;
+    uint64_t planes[DEBOUNCE_PORT_PLANES];
+    uint8_t samples;
+} DebouncePort;
+
+/**
+ * @brief Initializes a DebouncePort and synchronizes it with the port.
+ *
+ * @param p Pointer to the DebouncePort structure.
+ * @param samples Consecutive samples a change must persist (1..DEBOUNCE_PORT_MAX_SAMPLES).
+ *                Values outside the range are clamped.
+ * @param initial_input Current raw port value for synchronization.
+ *
+ * @note samples = 2 matches debounce_update() without a time_ref():
+ *       a change is accepted on the second identical sample.
+ */
+void debounce_port_init(DebouncePort *p, uint8_t samples, uint64_t initial_input);
+
+/**
+ * @brief Processes one debounce step for all pins of a port.
+ *
+ * @param p Pointer to the DebouncePort instance.
+ * @param input Raw port value (bit N = pin N).
+ * @return uint64_t Debounced (stable) port value.
+ */
+uint64_t debounce_port_update(DebouncePort *p, uint64_t input);
+
+/**
+ * @brief Returns the current debounced port value.
+ *
+ * @param p Pointer to the DebouncePort instance.
+ * @return uint64_t Stable output mask, same as Debounce::stable_output per pin.
+ */
+static inline uint64_t debounce_port_stable(const DebouncePort *p)
+{
+    return p ? p->stable_output : 0u;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBOUNCE_PORT_H_ */
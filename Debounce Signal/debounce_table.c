@@ -0,0 +1,91 @@
+/**
+ * @file debounce_table.c
+ * @brief Implementation of the ROM-able tick-based debounce table
+ */
+
+#include "debounce_table.h"
+#include "../Common/bit_ops.h"
+
+// Mask of the valid channels of a word
+static inline uint64_t _debounce_table_valid(const DebounceTable *t, uint32_t word)
+{
+    uint32_t first = word * 64u;
+    if (first >= t->channels) return 0u;
+    return bit_mask64(t->channels - first);
+}
+
+static inline uint64_t _debounce_table_idle(const DebounceTable *t, uint32_t word)
+{
+    return t->idle ? t->idle[word] : 0u;
+}
+
+static inline uint32_t _debounce_table_settle(const DebounceTable *t, uint32_t channel)
+{
+    return t->settle_ticks ? t->settle_ticks[channel] : t->settle_default;
+}
+
+uint8_t debounce_table_update_at(const DebounceTable *t, uint32_t channel, uint8_t input, uint32_t now)
+{
+    if (!t || channel >= t->channels) return 0;
+
+    uint32_t word = channel / 64u;
+    uint64_t bit = (uint64_t)1u << (channel % 64u);
+    uint64_t idle = _debounce_table_idle(t, word);
+    // Work relative to the idle level, like the stored state
+    uint64_t sample = ((input != 0) ? bit : 0u) ^ (idle & bit);
+
+    if ((t->raw[word] & bit) != sample) {
+        // Raw change → restart the settle period
+        t->raw[word] ^= bit;
+        t->changed_at[channel] = now;
+    } else if ((t->stable[word] & bit) != sample &&
+               (uint32_t)(now - t->changed_at[channel]) >= _debounce_table_settle(t, channel)) {
+        t->stable[word] ^= bit;
+    }
+
+    return (uint8_t)(((t->stable[word] ^ idle) >> (channel % 64u)) & 1u);
+}
+
+uint64_t debounce_table_update_word_at(const DebounceTable *t, uint32_t word, uint64_t sample, uint32_t now)
+{
+    if (!t || word >= DEBOUNCE_TABLE_WORDS(t->channels)) return 0u;
+
+    uint64_t idle = _debounce_table_idle(t, word);
+    uint64_t valid = _debounce_table_valid(t, word);
+    sample = (sample ^ idle) & valid;
+
+    // Raw changes restart the settle period of their channels
+    uint64_t changed = t->raw[word] ^ sample;
+    t->raw[word] = sample;
+    for (uint64_t m = changed; m; m &= m - 1u)
+        t->changed_at[word * 64u + bit_ctz64(m)] = now;
+
+    // Unchanged channels that differ from their output are settling
+    uint64_t stable = t->stable[word];
+    for (uint64_t m = (sample ^ stable) & ~changed; m; m &= m - 1u) {
+        uint32_t channel = word * 64u + bit_ctz64(m);
+        if ((uint32_t)(now - t->changed_at[channel]) >= _debounce_table_settle(t, channel))
+            stable ^= m & (~m + 1u);
+    }
+    t->stable[word] = stable;
+
+    return (stable ^ idle) & valid;
+}
+
+uint8_t debounce_table_output(const DebounceTable *t, uint32_t channel)
+{
+    if (!t || channel >= t->channels) return 0;
+    uint32_t word = channel / 64u;
+    return (uint8_t)(((t->stable[word] ^ _debounce_table_idle(t, word)) >> (channel % 64u)) & 1u);
+}
+
+void debounce_table_reset(const DebounceTable *t)
+{
+    if (!t) return;
+    for (uint32_t w = 0; w < DEBOUNCE_TABLE_WORDS(t->channels); w++) {
+        t->raw[w] = 0u;
+        t->stable[w] = 0u;
+    }
+    for (uint32_t c = 0; c < t->channels; c++)
+        t->changed_at[c] = 0u;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file debounce_table.h
+ * @author Radmehr
+ * @brief ROM-able tick-based debounce table with zero-initialized state
+ * @version 1.0
+ * @date 2026-10-14
+ *
+ * @details
+ * A DebounceTable separates what never changes from what does:
+ * - a `const` descriptor (placed in flash): state array addresses, idle
+ *   levels, settle times, channel count,
+ * - state in `.bss`: raw and stable levels packed 64 per word and stored
+ *   XOR the idle level, and the tick of the last raw change per channel.
+ *
+ * All-zero state means "every channel stable at its idle level", so the
+ * startup code's `.bss` clear replaces debounce_init_ticks() for every
+ * channel. Per channel the state costs 2 bits plus one 32-bit timestamp,
+ * against a full Debounce instance.
+ *
+ * Semantics match debounce_update_at(): a raw change restarts the settle
+ * period, and the output follows once the raw level has been unchanged for
+ * at least the settle time.
+ *
+ * Typical usage:
+ * @code
+ * static const uint32_t key_settle[64] = { 5, 5, 20, ... };  // per key, in ms
+ * DEBOUNCE_TABLE_DEFINE(keys, 64, 0, key_settle, 0);
+ * ...
+ * uint64_t pressed = debounce_table_update_word_at(&keys, 0, read_matrix(), millis());
+ * @endcode
+ */
+
+#ifndef DEBOUNCE_TABLE_H_
+#define DEBOUNCE_TABLE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Number of 64-bit state words needed for `n` channels. */
+#define DEBOUNCE_TABLE_WORDS(n) (((n) + 63u) / 64u)
+
+/**
+ * @brief Constant descriptor of a debounced channel bank (place it in flash).
+ */
+typedef struct {
+    uint64_t *raw;                  // State: last raw level XOR idle
+    uint64_t *stable;               // State: debounced level XOR idle
+    uint32_t *changed_at;           // State: tick of the last raw change, per channel
+    const uint64_t *idle;           // Idle level per channel, packed, or NULL for all low
+    const uint32_t *settle_ticks;   // Settle time per channel, or NULL to use settle_default
+    uint32_t settle_default;        // Settle time of every channel when settle_ticks is NULL
+    uint32_t channels;              // Number of channels
+} DebounceTable;
+
+/**
+ * @brief Defines zero-initialized state for `n` channels and a constant
+ *        DebounceTable `name` describing it.
+ */
+#define DEBOUNCE_TABLE_DEFINE(name, n, idle_words, settle_table, settle_all)        \
+    static uint64_t name##_raw[DEBOUNCE_TABLE_WORDS(n)];                            \
+    static uint64_t name##_stable[DEBOUNCE_TABLE_WORDS(n)];                         \
+    static uint32_t name##_changed_at[(n)];                                         \
+    static const DebounceTable name = { name##_raw, name##_stable, name##_changed_at, \
+                                        (idle_words), (settle_table), (settle_all), (n) }
+
+/**
+ * @brief Debounces one channel.
+ * @param t Pointer to the DebounceTable descriptor
+ * @param channel Channel number
+ * @param input Raw input (0 or 1)
+ * @param now Current tick; wrap-around is handled
+ * @return Debounced output (0 for invalid arguments)
+ */
+uint8_t debounce_table_update_at(const DebounceTable *t, uint32_t channel, uint8_t input, uint32_t now);
+
+/**
+ * @brief Debounces 64 channels at once.
+ * @param t Pointer to the DebounceTable descriptor
+ * @param word Word index (channels 64*word .. 64*word+63)
+ * @param sample Raw inputs of those channels (bit N = channel 64*word+N)
+ * @param now Current tick
+ * @return Debounced outputs of those channels
+ *
+ * @details
+ * The cost is a few word operations plus one step per channel that changed
+ * or is still settling; quiet channels are never visited.
+ */
+uint64_t debounce_table_update_word_at(const DebounceTable *t, uint32_t word, uint64_t sample, uint32_t now);
+
+/**
+ * @brief Debounced output of a channel.
+ * @param t Pointer to the DebounceTable descriptor
+ * @param channel Channel number
+ * @return 0 or 1 (0 for invalid arguments)
+ */
+uint8_t debounce_table_output(const DebounceTable *t, uint32_t channel);
+
+/**
+ * @brief Returns every channel to its idle level (the power-on state).
+ * @param t Pointer to the DebounceTable descriptor
+ */
+void debounce_table_reset(const DebounceTable *t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DEBOUNCE_TABLE_H_
@@ -0,0 +1,256 @@
+/**
+ * @file debounce_wheel.c
+ * @brief Implementation of the timer-wheel debounce scheduler (v1.0)
+ */
+
+#include "debounce_wheel.h"
+#include "../Common/bit_ops.h"
+
+#if (DEBOUNCE_WHEEL_LEVELS < 1u) || (DEBOUNCE_WHEEL_LEVELS > 5u)
+#error "DEBOUNCE_WHEEL_LEVELS must be between 1 and 5"
+#endif
+
+#define _WHEEL_BITS 6u
+#define _WHEEL_MASK (DEBOUNCE_WHEEL_SLOTS - 1u)
+
+static inline unsigned _wheel_index(uint32_t tick, unsigned level)
+{
+    return (unsigned)(tick >> (_WHEEL_BITS * level)) & _WHEEL_MASK;
+}
+
+/**
+ * @brief Internal helper: links a timer into the slot matching its deadline.
+ * Deadlines are taken relative to w->now and must not lie in the past.
+ */
+static void _wheel_link(DebounceWheel *w, DebounceTimer *t)
+{
+    uint32_t delta = t->deadline - w->now;
+    unsigned level = 0u;
+    unsigned slot;
+
+    while (level + 1u < DEBOUNCE_WHEEL_LEVELS &&
+           (delta >> (_WHEEL_BITS * (level + 1u))) != 0u) {
+        level++;
+    }
+
+    if (level + 1u == DEBOUNCE_WHEEL_LEVELS &&
+        (_WHEEL_BITS * (level + 1u)) < 32u &&
+        (delta >> (_WHEEL_BITS * (level + 1u))) != 0u) {
+        // Beyond the horizon → park in the last top-level slot, re-queued later
+        slot = (_wheel_index(w->now, level) + _WHEEL_MASK) & _WHEEL_MASK;
+    }
+    else {
+        slot = _wheel_index(t->deadline, level);
+    }
+
+    t->level = (uint8_t)level;
+    t->slot = (uint8_t)slot;
+    t->prev = 0;
+    t->next = w->slots[level][slot];
+    if (t->next) t->next->prev = t;
+    w->slots[level][slot] = t;
+    w->occupied[level] |= (uint64_t)1u << slot;
+    t->pending = 1u;
+    w->pending++;
+}
+
+static void _wheel_unlink(DebounceWheel *w, DebounceTimer *t)
+{
+    if (t->prev) t->prev->next = t->next;
+    else         w->slots[t->level][t->slot] = t->next;
+    if (t->next) t->next->prev = t->prev;
+
+    if (!w->slots[t->level][t->slot])
+        w->occupied[t->level] &= ~((uint64_t)1u << t->slot);
+
+    t->next = 0;
+    t->prev = 0;
+    t->pending = 0u;
+    w->pending--;
+}
+
+/**
+ * @brief Internal helper: takes a whole slot list out of the wheel.
+ */
+static DebounceTimer *_wheel_take_slot(DebounceWheel *w, unsigned level, unsigned slot)
+{
+    DebounceTimer *list = w->slots[level][slot];
+    w->slots[level][slot] = 0;
+    w->occupied[level] &= ~((uint64_t)1u << slot);
+    for (DebounceTimer *t = list; t; t = t->next) {
+        t->pending = 0u;
+        w->pending--;
+    }
+    return list;
+}
+
+/**
+ * @brief Internal helper: moves due coarse slots into finer levels.
+ * Called when w->now crosses a level-0 wrap; higher levels first so their
+ * timers can still be cascaded further down in the same pass.
+ */
+static void _wheel_cascade(DebounceWheel *w)
+{
+    unsigned top = 0u;
+    while (top + 1u < DEBOUNCE_WHEEL_LEVELS &&
+           (w->now & ((1u << (_WHEEL_BITS * (top + 1u))) - 1u)) == 0u) {
+        top++;
+    }
+
+    for (unsigned level = top; level >= 1u; level--) {
+        DebounceTimer *t = _wheel_take_slot(w, level, _wheel_index(w->now, level));
+        while (t) {
+            DebounceTimer *next = t->next;
+            _wheel_link(w, t);
+            t = next;
+        }
+    }
+}
+
+static uint32_t _wheel_fire(DebounceWheel *w, unsigned slot)
+{
+    uint32_t changed = 0u;
+    DebounceTimer *t = _wheel_take_slot(w, 0u, slot);
+
+    while (t) {
+        DebounceTimer *next = t->next;
+        t->next = 0;
+        t->prev = 0;
+        if ((int32_t)(t->deadline - w->now) > 0) {
+            _wheel_link(w, t); // Parked beyond the horizon, not due yet
+            t = next;
+            continue;
+        }
+        // Input has not changed since scheduling → the new level is confirmed
+        if (t->deb.stable_output != t->deb.prev_input) {
+            t->deb.stable_output = t->deb.prev_input;
+            changed++;
+            if (t->on_change)
+                t->on_change(t->ctx, t, t->deb.stable_output);
+        }
+        t = next;
+    }
+    return changed;
+}
+
+void debounce_wheel_init(DebounceWheel *w, uint32_t now)
+{
+    if (!w) return;
+    for (unsigned l = 0; l < DEBOUNCE_WHEEL_LEVELS; l++) {
+        for (unsigned s = 0; s < DEBOUNCE_WHEEL_SLOTS; s++) {
+            w->slots[l][s] = 0;
+        }
+        w->occupied[l] = 0u;
+    }
+    w->now = now;
+    w->pending = 0u;
+}
+
+void debounce_timer_init(DebounceTimer *t, uint32_t settle_ticks, uint8_t initial_input,
+                         DebounceWheelCallback on_change, void *ctx)
+{
+    if (!t) return;
+    debounce_init_ticks(&t->deb, settle_ticks, initial_input, 0u);
+    t->next = 0;
+    t->prev = 0;
+    t->on_change = on_change;
+    t->ctx = ctx;
+    t->deadline = 0u;
+    t->level = 0u;
+    t->slot = 0u;
+    t->pending = 0u;
+}
+
+uint8_t debounce_wheel_input(DebounceWheel *w, DebounceTimer *t, uint8_t input, uint32_t now)
+{
+    if (!w || !t) return 0;
+    input = (input != 0); // Normalize input to 0/1
+
+    if (input == t->deb.prev_input) {
+        return t->deb.stable_output; // No change → nothing to schedule
+    }
+
+    t->deb.prev_input = input;
+    t->deb.changed_at = now;
+    if (t->pending) _wheel_unlink(w, t);
+
+    if (input == t->deb.stable_output) {
+        return t->deb.stable_output; // Bounced back before confirmation
+    }
+
+    if (t->deb.settle_ticks == 0u) {
+        t->deb.stable_output = input;
+        if (t->on_change)
+            t->on_change(t->ctx, t, input);
+        return input;
+    }
+
+    t->deadline = now + t->deb.settle_ticks;
+    // A deadline not after the wheel time fires on the next processed tick
+    if ((int32_t)(t->deadline - w->now) <= 0)
+        t->deadline = w->now + 1u;
+    _wheel_link(w, t);
+
+    return t->deb.stable_output;
+}
+
+/**
+ * @brief Internal helper: ticks from w->now to the next fire or cascade
+ * tick of an occupied slot (1 .. 2^32 - 1, the wheel must not be empty).
+ */
+static uint32_t _wheel_next_event(const DebounceWheel *w)
+{
+    uint32_t best = UINT32_MAX;
+    for (unsigned level = 0; level < DEBOUNCE_WHEEL_LEVELS; level++) {
+        uint64_t occ = w->occupied[level];
+        if (!occ) continue;
+
+        // First occupied slot after the current one (wrapping), 1..64 slots away
+        unsigned from = (_wheel_index(w->now, level) + 1u) & _WHEEL_MASK;
+        uint64_t rot = (occ >> from) | (from ? (occ << (DEBOUNCE_WHEEL_SLOTS - from)) : 0u);
+        uint32_t slots_ahead = bit_ctz64(rot) + 1u;
+
+        // Level 0 fires at the slot tick, level k cascades at the slot start
+        uint32_t shift = _WHEEL_BITS * level;
+        uint32_t base = (w->now >> shift) + slots_ahead;
+        uint32_t when = (shift < 32u) ? (base << shift) : 0u;
+        uint32_t delta = when - w->now;
+        if (delta < best) best = delta;
+    }
+    return best;
+}
+
+uint32_t debounce_wheel_advance(DebounceWheel *w, uint32_t now)
+{
+    if (!w) return 0u;
+    uint32_t changed = 0u;
+
+    while (w->now != now) {
+        uint32_t remaining = now - w->now;
+        // Next tick of interest: an occupied level-0 slot or the cascade of
+        // an occupied higher slot; the wraps in between only meet empty slots
+        uint32_t step = (w->pending == 0u) ? UINT32_MAX : _wheel_next_event(w);
+        if (remaining < step) {
+            w->now = now;
+            break;
+        }
+
+        w->now += step;
+        if ((w->now & _WHEEL_MASK) == 0u) _wheel_cascade(w);
+        if (w->occupied[0] & ((uint64_t)1u << _wheel_index(w->now, 0u)))
+            changed += _wheel_fire(w, _wheel_index(w->now, 0u));
+    }
+    return changed;
+}
+
+void debounce_wheel_cancel(DebounceWheel *w, DebounceTimer *t)
+{
+    if (!w || !t || !t->pending) return;
+    _wheel_unlink(w, t);
+}
+
+uint32_t debounce_wheel_next_deadline(const DebounceWheel *w)
+{
+    if (!w || w->pending == 0u) return UINT32_MAX;
+    return _wheel_next_event(w);
+}
@@ -0,0 +1,203 @@
+/**
+ * @file debounce_wheel.h
+ * @author Radmehr
+ * @brief Deadline-driven debounce using a hierarchical timer wheel (v1.0)
+ * @version 1.0
+ * @date 2026-10-14
+ *
+ * @details
+ * Instead of polling every pin every tick, a pin is only touched when its
+ * raw input changes (debounce_wheel_input(), e.g. from a pin-change ISR or
+ * a port diff) and when its settle deadline expires (debounce_wheel_advance()).
+ * Pending deadlines are kept in DEBOUNCE_WHEEL_LEVELS wheels of 64 slots;
+ * level k has a resolution of 64^k ticks and far deadlines are cascaded
+ * into finer levels as time advances. Work per tick therefore scales with
+ * the number of bouncing pins, and debounce_wheel_next_deadline() tells how
+ * long the MCU may sleep.
+ *
+ * Typical usage:
+ * @code
+ * static DebounceWheel wheel;
+ * static DebounceTimer keys[KEY_COUNT];
+ *
+ * debounce_wheel_init(&wheel, ticks());
+ * for (i = 0; i < KEY_COUNT; i++)
+ *     debounce_timer_init(&keys[i], 20, read_key(i), on_key, NULL);
+ *
+ * // on pin change:  debounce_wheel_input(&wheel, &keys[i], read_key(i), ticks());
+ * // in the tick:    debounce_wheel_advance(&wheel, ticks());
+ * @endcode
+ */
+
+#ifndef DEBOUNCE_WHEEL_H_
+#define DEBOUNCE_WHEEL_H_
+
+#include <stdint.h>
+
+#include "debounce.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of wheel levels (1..5). Deadlines up to 64^LEVELS ticks
+ * away are placed directly; later ones are re-queued at the top level.
+ */
+#ifndef DEBOUNCE_WHEEL_LEVELS
+#define DEBOUNCE_WHEEL_LEVELS 4u
+#endif
+
+/** @brief Slots per level (fixed: one bit per slot in a 64-bit occupancy mask). */
+#define DEBOUNCE_WHEEL_SLOTS 64u
+
+struct DebounceTimer;
+
+/**
+ * @brief Called when a timer's stable output changes.
+ * @param ctx User context given to debounce_timer_init().
+ * @param timer The timer whose output changed.
+ * @param stable_output New debounced level.
+ */
+typedef void (*DebounceWheelCallback)(void *ctx, struct DebounceTimer *timer, uint8_t stable_output);
+
+/**
+ * @struct DebounceTimer
+ * @brief One debounced input scheduled on a DebounceWheel.
+ *
+ * @var DebounceTimer::deb
+ *      Tick-mode debounce state (settle time, raw and stable level).
+ *
+ * @var DebounceTimer::next
+ *      Next timer in the same slot (intrusive list).
+ *
+ * @var DebounceTimer::prev
+ *      Previous timer in the same slot.
+ *
+ * @var DebounceTimer::on_change
+ *      Optional callback on stable output change.
+ *
+ * @var DebounceTimer::ctx
+ *      User context passed to on_change.
+ *
+ * @var DebounceTimer::deadline
+ *      Tick at which the pending change is confirmed.
+ *
+ * @var DebounceTimer::level
+ *      Wheel level of the pending deadline.
+ *
+ * @var DebounceTimer::slot
+ *      Slot of the pending deadline.
+ *
+ * @var DebounceTimer::pending
+ *      1 while the timer is linked into the wheel.
+ */
+typedef struct DebounceTimer {
+    Debounce deb;
+    struct DebounceTimer *next;
+    struct DebounceTimer *prev;
+    DebounceWheelCallback on_change;
+    void *ctx;
+    uint32_t deadline;
+    uint8_t level;
+    uint8_t slot;
+    uint8_t pending;
+} DebounceTimer;
+
+/**
+ * @struct DebounceWheel
+ * @brief Hierarchical timer wheel holding pending debounce deadlines.
+ *
+ * @var DebounceWheel::slots
+ *      Slot list heads per level.
+ *
+ * @var DebounceWheel::occupied
+ *      Non-empty slots per level, one bit per slot.
+ *
+ * @var DebounceWheel::now
+ *      Last processed tick.
+ *
+ * @var DebounceWheel::pending
+ *      Number of scheduled timers.
+ */
+typedef struct {
+    DebounceTimer *slots[DEBOUNCE_WHEEL_LEVELS][DEBOUNCE_WHEEL_SLOTS];
+    uint64_t occupied[DEBOUNCE_WHEEL_LEVELS];
+    uint32_t now;
+    uint32_t pending;
+} DebounceWheel;
+
+/**
+ * @brief Initializes an empty wheel.
+ *
+ * @param w Pointer to the DebounceWheel.
+ * @param now Current tick.
+ */
+void debounce_wheel_init(DebounceWheel *w, uint32_t now);
+
+/**
+ * @brief Initializes a timer and synchronizes it with the input.
+ *
+ * @param t Pointer to the DebounceTimer.
+ * @param settle_ticks Ticks a new level must persist before it is accepted.
+ * @param initial_input The current raw input signal (0 or 1).
+ * @param on_change Optional callback on stable output change (may be NULL).
+ * @param ctx User context passed to on_change.
+ */
+void debounce_timer_init(DebounceTimer *t, uint32_t settle_ticks, uint8_t initial_input,
+                         DebounceWheelCallback on_change, void *ctx);
+
+/**
+ * @brief Reports a raw input sample of one timer.
+ *
+ * @param w Pointer to the DebounceWheel.
+ * @param t Pointer to the DebounceTimer.
+ * @param input Raw digital signal (0 or 1).
+ * @param now Current tick.
+ * @return uint8_t Debounced (stable) signal.
+ *
+ * @details
+ * - Unchanged input: returns immediately, nothing is scheduled.
+ * - Changed input: (re)schedules the timer at now + settle_ticks, or
+ *   cancels it if the input went back to the stable level.
+ * - A zero settle time accepts the change immediately.
+ */
+uint8_t debounce_wheel_input(DebounceWheel *w, DebounceTimer *t, uint8_t input, uint32_t now);
+
+/**
+ * @brief Advances the wheel to `now` and confirms all expired timers.
+ *
+ * @param w Pointer to the DebounceWheel.
+ * @param now Current tick (must not be more than 2^31 ticks ahead).
+ * @return uint32_t Number of timers whose stable output changed.
+ *
+ * @details
+ * The occupancy masks of all levels give the next tick at which a slot
+ * fires or cascades, and the wheel jumps straight there. The cost grows
+ * with the number of occupied slots passed, not with the elapsed ticks,
+ * so a long tickless sleep costs a few iterations per pending timer.
+ */
+uint32_t debounce_wheel_advance(DebounceWheel *w, uint32_t now);
+
+/**
+ * @brief Removes a timer from the wheel without confirming its change.
+ *
+ * @param w Pointer to the DebounceWheel.
+ * @param t Pointer to the DebounceTimer.
+ */
+void debounce_wheel_cancel(DebounceWheel *w, DebounceTimer *t);
+
+/**
+ * @brief Ticks until the wheel next needs debounce_wheel_advance().
+ *
+ * @param w Pointer to the DebounceWheel.
+ * @return uint32_t Ticks from w->now (lower bound of the next deadline),
+ *         or UINT32_MAX when nothing is pending.
+ */
+uint32_t debounce_wheel_next_deadline(const DebounceWheel *w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBOUNCE_WHEEL_H_ */
@@ -0,0 +1,147 @@
+/**
+ * @file    debounced_edge.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the fused debounce-then-edge stage.
+ * @license MIT
+ *
+ * @details
+ * An edge of the debounced output can only happen when the raw input is
+ * unchanged and differs from the stable output, so the edge detector needs
+ * no state of its own and its branch is skipped on the common path.
+ */
+
+#include "debounced_edge.h"
+
+/**
+ * @brief Counts an accepted change of the stable output and reports it.
+ */
+static inline EdgeType _debounced_edge_accept(DebouncedEdge *de, uint8_t input)
+{
+    EdgeType type;
+
+    de->stable_output = input;
+    if (input) {
+        de->rise_count++;
+        type = EDGE_RISING;
+    } else {
+        de->fall_count++;
+        type = EDGE_FALLING;
+    }
+    if (de->on_edge)
+        de->on_edge(de->ctx, type, de->id);
+    return type;
+}
+
+void debounced_edge_init(DebouncedEdge *de, uint8_t (*time_ref)(void), uint8_t initial_input)
+{
+    if (!de) return;
+    de->time_ref = time_ref;
+    de->on_edge = 0; /* No callback by default */
+    de->ctx = 0;
+    de->rise_count = 0u;
+    de->fall_count = 0u;
+    de->changed_at = 0u;
+    de->settle_ticks = 0u;
+    de->id = 0u;
+    de->prev_input = (initial_input != 0u);
+    de->stable_output = de->prev_input;
+}
+
+void debounced_edge_init_ticks(DebouncedEdge *de, uint32_t settle_ticks,
+                               uint8_t initial_input, uint32_t now)
+{
+    if (!de) return;
+    debounced_edge_init(de, 0, initial_input);
+    de->changed_at = now;
+    de->settle_ticks = settle_ticks;
+}
+
+void debounced_edge_set_callback(DebouncedEdge *de, EdgeCallback fn, void *ctx, uint32_t signal_id)
+{
+    if (!de) return;
+    de->on_edge = fn;
+    de->ctx = ctx;
+    de->id = signal_id;
+}
+
+EdgeType debounced_edge_update(DebouncedEdge *de, uint8_t input)
+{
+    if (!de) return EDGE_NONE;
+    input = (input != 0u);
+
+    uint8_t ready = de->time_ref ? de->time_ref() : 1u;
+    if (input != de->prev_input) {
+        de->prev_input = input; /* Not yet confirmed */
+        return EDGE_NONE;
+    }
+    if (!ready || input == de->stable_output) return EDGE_NONE;
+
+    return _debounced_edge_accept(de, input);
+}
+
+EdgeType debounced_edge_update_at(DebouncedEdge *de, uint8_t input, uint32_t now)
+{
+    if (!de) return EDGE_NONE;
+    input = (input != 0u);
+
+    if (input != de->prev_input) {
+        de->prev_input = input;
+        de->changed_at = now; /* Restart the settle period */
+        return EDGE_NONE;
+    }
+    if (input == de->stable_output || (uint32_t)(now - de->changed_at) < de->settle_ticks)
+        return EDGE_NONE;
+
+    return _debounced_edge_accept(de, input);
+}
+
+void debounced_edge_reset(DebouncedEdge *de)
+{
+    if (!de) return;
+    de->rise_count = 0u;
+    de->fall_count = 0u;
+}
+
+uint32_t debounced_edge_get_rise_count(const DebouncedEdge *de)
+{
+    return de ? de->rise_count : 0u;
+}
+
+uint32_t debounced_edge_get_fall_count(const DebouncedEdge *de)
+{
+    return de ? de->fall_count : 0u;
+}
+
+void debounced_edge_bank_init(DebouncedEdgeBank *bank, uint8_t samples, uint64_t initial_input)
+{
+    if (!bank) return;
+    debounce_port_init(&bank->port, samples, initial_input);
+    bank->rising = 0u;
+    bank->falling = 0u;
+    bank->on_edges = 0; /* No callback by default */
+    bank->ctx = 0;
+}
+
+void debounced_edge_bank_set_callback(DebouncedEdgeBank *bank, EdgeBank64Callback fn, void *ctx)
+{
+    if (!bank) return;
+    bank->on_edges = fn;
+    bank->ctx = ctx;
+}
+
+uint64_t debounced_edge_bank_update(DebouncedEdgeBank *bank, uint64_t input)
+{
+    if (!bank) return 0u;
+
+    uint64_t prev = bank->port.stable_output;
+    uint64_t stable = debounce_port_update(&bank->port, input);
+    uint64_t changed = prev ^ stable;
+
+    bank->rising = changed & stable;
+    bank->falling = changed & prev;
+    if (changed && bank->on_edges)
+        bank->on_edges(bank->ctx, bank->rising, bank->falling);
+    return changed;
+}
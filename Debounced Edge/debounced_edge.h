@@ -0,0 +1,240 @@
+/**
+ * @file    debounced_edge.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Fused debounce-then-edge pipeline stage.
+ * @license MIT
+ *
+ * @details
+ * Replaces the usual per-pin chain
+ * @code
+ * edge_update(&det, debounce_update(&deb, raw));
+ * @endcode
+ * with one element and one call. The debounced output doubles as the
+ * previous sample of the edge detector, so the state is a single struct,
+ * the input is normalized once and each sample takes one branch on the
+ * common "no change" path.
+ *
+ * Both Debounce timing modes are available (time_ref() callback and tick
+ * mode), with `edge_update()` semantics on the debounced output: counters,
+ * optional callbacks and the returned EdgeType.
+ *
+ * For whole ports, DebouncedEdgeBank fuses DebouncePort with the edge masks
+ * of EdgeBank64.
+ */
+
+#ifndef DEBOUNCED_EDGE_H
+#define DEBOUNCED_EDGE_H
+
+#include <stdint.h>
+
+#include "../Edge Detector/edge_detector.h"
+#include "../Edge Detector/edge_bank.h"
+#include "../Debounce Signal/debounce_port.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct DebouncedEdge
+ * @brief Debounce and edge state of one signal.
+ *
+ * @var DebouncedEdge::time_ref
+ *      Optional timing function (see Debounce::time_ref); NULL in tick mode.
+ * @var DebouncedEdge::on_edge
+ *      Optional callback on debounced edges (id = `id`).
+ * @var DebouncedEdge::ctx
+ *      User context passed to `on_edge`.
+ * @var DebouncedEdge::rise_count
+ *      Number of debounced rising edges.
+ * @var DebouncedEdge::fall_count
+ *      Number of debounced falling edges.
+ * @var DebouncedEdge::changed_at
+ *      Tick of the last raw input change (tick mode).
+ * @var DebouncedEdge::settle_ticks
+ *      Ticks the input must stay unchanged before it is accepted (tick mode).
+ * @var DebouncedEdge::id
+ *      Signal id passed to `on_edge`.
+ * @var DebouncedEdge::prev_input
+ *      Last observed raw input (0 or 1).
+ * @var DebouncedEdge::stable_output
+ *      Debounced output, also the previous sample of the edge detector.
+ */
+typedef struct {
+    uint8_t (*time_ref)(void);
+    EdgeCallback on_edge;
+    void *ctx;
+    uint32_t rise_count;
+    uint32_t fall_count;
+    uint32_t changed_at;
+    uint32_t settle_ticks;
+    uint32_t id;
+    uint8_t prev_input;
+    uint8_t stable_output;
+} DebouncedEdge;
+
+/**
+ * @brief Initializes the stage with a time_ref() as in `debounce_init()`.
+ * @param de Pointer to the DebouncedEdge instance.
+ * @param time_ref Timing function, or NULL to accept changes immediately.
+ * @param initial_input Current raw input; output and edge state start there.
+ */
+void debounced_edge_init(DebouncedEdge *de, uint8_t (*time_ref)(void), uint8_t initial_input);
+
+/**
+ * @brief Initializes the stage in tick mode as in `debounce_init_ticks()`.
+ * @param de Pointer to the DebouncedEdge instance.
+ * @param settle_ticks Ticks a new input level must persist before it is accepted.
+ * @param initial_input Current raw input; output and edge state start there.
+ * @param now Current tick.
+ */
+void debounced_edge_init_ticks(DebouncedEdge *de, uint32_t settle_ticks,
+                               uint8_t initial_input, uint32_t now);
+
+/**
+ * @brief Assigns the callback invoked on each debounced edge.
+ * @param de Pointer to the DebouncedEdge instance.
+ * @param fn Callback, or NULL to remove it.
+ * @param ctx User context passed back on every edge.
+ * @param signal_id Identifier passed back on every edge.
+ */
+void debounced_edge_set_callback(DebouncedEdge *de, EdgeCallback fn, void *ctx, uint32_t signal_id);
+
+/**
+ * @brief Processes one raw sample (time_ref() mode).
+ * @param de Pointer to the DebouncedEdge instance.
+ * @param input Raw digital signal (0 or 1).
+ * @return EdgeType of the debounced output: EDGE_NONE, EDGE_RISING, or EDGE_FALLING.
+ *
+ * @details
+ * Same result as `edge_update(det, debounce_update(deb, input))` with both
+ * halves initialized to `initial_input`.
+ */
+EdgeType debounced_edge_update(DebouncedEdge *de, uint8_t input);
+
+/**
+ * @brief Processes one raw sample (tick mode).
+ * @param de Pointer to the DebouncedEdge instance.
+ * @param input Raw digital signal (0 or 1).
+ * @param now Monotonic tick counter; wrap-around is handled.
+ * @return EdgeType of the debounced output.
+ *
+ * @details
+ * Same result as `edge_update(det, debounce_update_at(deb, input, now))`.
+ */
+EdgeType debounced_edge_update_at(DebouncedEdge *de, uint8_t input, uint32_t now);
+
+/**
+ * @brief Returns the debounced output.
+ * @param de Pointer to the DebouncedEdge instance.
+ * @return Stable level (0 or 1).
+ */
+static inline uint8_t debounced_edge_output(const DebouncedEdge *de)
+{
+    return de ? de->stable_output : 0u;
+}
+
+/**
+ * @brief Resets the edge counters (the debounce state is kept).
+ * @param de Pointer to the DebouncedEdge instance.
+ */
+void debounced_edge_reset(DebouncedEdge *de);
+
+/**
+ * @brief Retrieves the debounced rising edge count.
+ * @param de Pointer to the DebouncedEdge instance.
+ * @return Number of rising edges detected.
+ */
+uint32_t debounced_edge_get_rise_count(const DebouncedEdge *de);
+
+/**
+ * @brief Retrieves the debounced falling edge count.
+ * @param de Pointer to the DebouncedEdge instance.
+ * @return Number of falling edges detected.
+ */
+uint32_t debounced_edge_get_fall_count(const DebouncedEdge *de);
+
+/**
+ * @struct DebouncedEdgeBank
+ * @brief Debounce and edge state of up to 64 signals of one port.
+ *
+ * @var DebouncedEdgeBank::port
+ *      Vertical-counter debounce; its stable output is the previous sample.
+ * @var DebouncedEdgeBank::rising
+ *      Debounced rising edges of the last update.
+ * @var DebouncedEdgeBank::falling
+ *      Debounced falling edges of the last update.
+ * @var DebouncedEdgeBank::on_edges
+ *      Optional batched callback, called once per update with any edge.
+ * @var DebouncedEdgeBank::ctx
+ *      User context passed to `on_edges`.
+ */
+typedef struct {
+    DebouncePort port;
+    uint64_t rising;
+    uint64_t falling;
+    EdgeBank64Callback on_edges;
+    void *ctx;
+} DebouncedEdgeBank;
+
+/**
+ * @brief Initializes a port stage and synchronizes it with the port.
+ * @param bank Pointer to the DebouncedEdgeBank instance.
+ * @param samples Consecutive samples a change must persist (see `debounce_port_init()`).
+ * @param initial_input Current raw port value.
+ */
+void debounced_edge_bank_init(DebouncedEdgeBank *bank, uint8_t samples, uint64_t initial_input);
+
+/**
+ * @brief Assigns the batched edge callback.
+ * @param bank Pointer to the DebouncedEdgeBank instance.
+ * @param fn Callback, or NULL to remove it.
+ * @param ctx User context passed back on every call.
+ */
+void debounced_edge_bank_set_callback(DebouncedEdgeBank *bank, EdgeBank64Callback fn, void *ctx);
+
+/**
+ * @brief Processes one raw port sample.
+ * @param bank Pointer to the DebouncedEdgeBank instance.
+ * @param input Raw port value (bit N = pin N).
+ * @return Mask of the pins whose debounced output changed.
+ *
+ * @details
+ * Same result as `edge_bank64_update(eb, debounce_port_update(port, input))`.
+ */
+uint64_t debounced_edge_bank_update(DebouncedEdgeBank *bank, uint64_t input);
+
+/**
+ * @brief Debounced port value.
+ * @param bank Pointer to the DebouncedEdgeBank instance.
+ */
+static inline uint64_t debounced_edge_bank_output(const DebouncedEdgeBank *bank)
+{
+    return bank ? bank->port.stable_output : 0u;
+}
+
+/**
+ * @brief Debounced rising edge mask of the last update.
+ * @param bank Pointer to the DebouncedEdgeBank instance.
+ */
+static inline uint64_t debounced_edge_bank_rising(const DebouncedEdgeBank *bank)
+{
+    return bank ? bank->rising : 0u;
+}
+
+/**
+ * @brief Debounced falling edge mask of the last update.
+ * @param bank Pointer to the DebouncedEdgeBank instance.
+ */
+static inline uint64_t debounced_edge_bank_falling(const DebouncedEdgeBank *bank)
+{
+    return bank ? bank->falling : 0u;
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DEBOUNCED_EDGE_H */
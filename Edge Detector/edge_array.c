@@ -0,0 +1,155 @@
+/**
+ * @file    edge_array.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the structure-of-arrays edge detector.
+ * @license MIT
+ *
+ * @details
+ * Words are diffed as in edge_bank.c; the set bits of the change mask are
+ * then visited with count-trailing-zeros, so the work per word is
+ * proportional to the number of edges, not to the number of channels.
+ */
+
+#include "edge_array.h"
+#include "../Common/bit_ops.h"
+
+/**
+ * @brief Mask of the valid channels of a word.
+ */
+static inline uint64_t _edge_array_valid(const EdgeArray *arr, uint32_t word)
+{
+    uint32_t first = word * 64u;
+    if (first >= arr->channels) return 0u;
+    return bit_mask64(arr->channels - first);
+}
+
+void edge_array_init(EdgeArray *arr, uint64_t *prev, uint32_t *rise_count,
+                     uint32_t *fall_count, uint32_t channels)
+{
+    if (!arr) return;
+    arr->prev = prev;
+    arr->rise_count = rise_count;
+    arr->fall_count = fall_count;
+    arr->on_edge = 0; /* No callback by default */
+    arr->ctx = 0;
+    arr->rate = 0;
+    arr->channels = (prev && rise_count && fall_count) ? channels : 0u;
+
+    for (uint32_t w = 0; w < EDGE_ARRAY_WORDS(arr->channels); w++)
+        arr->prev[w] = 0u;
+    edge_array_reset(arr);
+}
+
+void edge_array_set_callback(EdgeArray *arr, EdgeCallback fn, void *ctx)
+{
+    if (!arr) return;
+    arr->on_edge = fn;
+    arr->ctx = ctx;
+}
+
+void edge_array_attach_rate(EdgeArray *arr, EdgeRate *rate)
+{
+    if (!arr) return;
+    arr->rate = rate;
+}
+
+void edge_array_set_word(EdgeArray *arr, uint32_t word, uint64_t sample)
+{
+    if (!arr || word >= EDGE_ARRAY_WORDS(arr->channels)) return;
+    arr->prev[word] = sample & _edge_array_valid(arr, word);
+}
+
+/**
+ * @brief Counts one kind of edge on every set bit of `mask`.
+ */
+static inline void _edge_array_count(EdgeArray *arr, uint32_t word, uint64_t mask, EdgeType type)
+{
+    uint32_t *counters = (type == EDGE_RISING) ? arr->rise_count : arr->fall_count;
+
+    while (mask) {
+        uint32_t channel = word * 64u + bit_ctz64(mask);
+        mask &= mask - 1u;
+        counters[channel]++;
+        if (arr->rate)
+            edge_rate_record(arr->rate, channel);
+        if (arr->on_edge)
+            arr->on_edge(arr->ctx, type, channel);
+    }
+}
+
+uint64_t edge_array_update_word(EdgeArray *arr, uint32_t word, uint64_t sample)
+{
+    if (!arr || word >= EDGE_ARRAY_WORDS(arr->channels)) return 0u;
+
+    sample &= _edge_array_valid(arr, word);
+    uint64_t changed = arr->prev[word] ^ sample;
+    arr->prev[word] = sample;
+
+    if (!arr->on_edge) {
+        _edge_array_count(arr, word, changed & sample, EDGE_RISING);
+        _edge_array_count(arr, word, changed & ~sample, EDGE_FALLING);
+        return changed;
+    }
+
+    /* Callbacks are delivered in channel order. */
+    uint64_t pending = changed;
+    while (pending) {
+        uint64_t lowest = pending & (~pending + 1u);
+        pending &= pending - 1u;
+        _edge_array_count(arr, word, lowest, (sample & lowest) ? EDGE_RISING : EDGE_FALLING);
+    }
+    return changed;
+}
+
+void edge_array_apply_masks(EdgeArray *arr, uint32_t word, uint64_t rising,
+                            uint64_t falling, uint64_t level)
+{
+    if (!arr || word >= EDGE_ARRAY_WORDS(arr->channels)) return;
+
+    uint64_t valid = _edge_array_valid(arr, word);
+    uint64_t was_high = arr->prev[word];
+    rising &= valid;
+    falling &= valid;
+    arr->prev[word] = level & valid;
+
+    /* Channels that were high see their falling edge first. */
+    _edge_array_count(arr, word, falling & was_high, EDGE_FALLING);
+    _edge_array_count(arr, word, rising, EDGE_RISING);
+    _edge_array_count(arr, word, falling & ~was_high, EDGE_FALLING);
+}
+
+EdgeType edge_array_update(EdgeArray *arr, uint32_t channel, uint8_t input)
+{
+    if (!arr || channel >= arr->channels) return EDGE_NONE;
+
+    uint32_t word = channel / 64u;
+    uint64_t bit = (uint64_t)1u << (channel % 64u);
+    uint64_t sample = (input != 0u) ? (arr->prev[word] | bit) : (arr->prev[word] & ~bit);
+    uint64_t changed = edge_array_update_word(arr, word, sample);
+
+    if (!(changed & bit)) return EDGE_NONE;
+    return (input != 0u) ? EDGE_RISING : EDGE_FALLING;
+}
+
+void edge_array_reset(EdgeArray *arr)
+{
+    if (!arr) return;
+    for (uint32_t c = 0; c < arr->channels; c++) {
+        arr->rise_count[c] = 0u;
+        arr->fall_count[c] = 0u;
+    }
+}
+
+uint32_t edge_array_get_rise_count(const EdgeArray *arr, uint32_t channel)
+{
+    if (!arr || channel >= arr->channels) return 0u;
+    return arr->rise_count[channel];
+}
+
+uint32_t edge_array_get_fall_count(const EdgeArray *arr, uint32_t channel)
+{
+    if (!arr || channel >= arr->channels) return 0u;
+    return arr->fall_count[channel];
+}
@@ -0,0 +1,181 @@
+/**
+ * @file    edge_array.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Structure-of-arrays edge detection for thousands of signals.
+ * @license MIT
+ *
+ * @details
+ * An EdgeArray keeps the state of many signals in separate, contiguous
+ * arrays instead of one EdgeDetector per signal:
+ * - previous samples packed 64 per word (1 bit per signal),
+ * - rising and falling counters in two `uint32_t` arrays,
+ * - one callback and context shared by all signals (the channel number
+ *   is passed as id).
+ * A full scan therefore touches 1/8 of a cache line of state per 64
+ * signals plus only the counters of signals that actually changed.
+ *
+ * The callback and an attached EdgeRate only see edges found by the
+ * `edge_array_*` update calls. Code that writes `rise_count` /
+ * `fall_count` directly must count those edges itself.
+ *
+ * Storage is provided by the caller (no dynamic allocation):
+ * @code
+ * #define CHANNELS 1000
+ * static uint64_t prev[EDGE_ARRAY_WORDS(CHANNELS)];
+ * static uint32_t rises[CHANNELS], falls[CHANNELS];
+ * static EdgeArray inputs;
+ *
+ * edge_array_init(&inputs, prev, rises, falls, CHANNELS);
+ * for (uint32_t w = 0; w < EDGE_ARRAY_WORDS(CHANNELS); w++)
+ *     edge_array_update_word(&inputs, w, read_port64(w));
+ * uint32_t n = edge_array_get_rise_count(&inputs, 42);
+ * @endcode
+ */
+
+#ifndef EDGE_ARRAY_H
+#define EDGE_ARRAY_H
+
+#include <stdint.h>
+
+#include "edge_detector.h"
+#include "edge_rate.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Number of 64-bit state words needed for `n` channels. */
+#define EDGE_ARRAY_WORDS(n) (((n) + 63u) / 64u)
+
+/**
+ * @struct EdgeArray
+ * @brief State of `channels` signals in structure-of-arrays layout.
+ *
+ * @var EdgeArray::prev
+ *      Previous samples, channel c is bit (c % 64) of word (c / 64).
+ * @var EdgeArray::rise_count
+ *      Rising edge counter per channel.
+ * @var EdgeArray::fall_count
+ *      Falling edge counter per channel.
+ * @var EdgeArray::on_edge
+ *      Optional callback shared by all channels (id = channel number).
+ * @var EdgeArray::ctx
+ *      User context passed to `on_edge`.
+ * @var EdgeArray::rate
+ *      Optional windowed statistics fed with every edge (see edge_rate.h).
+ * @var EdgeArray::channels
+ *      Number of channels.
+ */
+typedef struct {
+    uint64_t *prev;         /**< Packed previous samples. */
+    uint32_t *rise_count;   /**< Rising edge counters. */
+    uint32_t *fall_count;   /**< Falling edge counters. */
+    EdgeCallback on_edge;   /**< Optional shared callback. */
+    void *ctx;              /**< Context for `on_edge`. */
+    struct EdgeRate *rate;  /**< Optional rate statistics. */
+    uint32_t channels;      /**< Number of channels. */
+} EdgeArray;
+
+/**
+ * @brief Initializes an array over caller-provided storage.
+ * @param arr Pointer to the EdgeArray instance.
+ * @param prev Array of EDGE_ARRAY_WORDS(channels) words.
+ * @param rise_count Array of `channels` counters.
+ * @param fall_count Array of `channels` counters.
+ * @param channels Number of channels.
+ * @note All channels start low with zero counters; use
+ *       `edge_array_set_word()` to synchronize with the inputs.
+ */
+void edge_array_init(EdgeArray *arr, uint64_t *prev, uint32_t *rise_count,
+                     uint32_t *fall_count, uint32_t channels);
+
+/**
+ * @brief Assigns the shared callback.
+ * @param arr Pointer to the EdgeArray instance.
+ * @param fn Callback, or NULL to remove it.
+ * @param ctx User context passed back on every edge.
+ */
+void edge_array_set_callback(EdgeArray *arr, EdgeCallback fn, void *ctx);
+
+/**
+ * @brief Attaches windowed rate statistics, see edge_rate.h.
+ * @param arr Pointer to the EdgeArray instance.
+ * @param rate Initialized EdgeRate over the same channels, or NULL to detach.
+ */
+void edge_array_attach_rate(EdgeArray *arr, EdgeRate *rate);
+
+/**
+ * @brief Sets the previous samples of 64 channels without counting edges.
+ * @param arr Pointer to the EdgeArray instance.
+ * @param word Word index (channels 64*word .. 64*word+63).
+ * @param sample Current samples of those channels.
+ */
+void edge_array_set_word(EdgeArray *arr, uint32_t word, uint64_t sample);
+
+/**
+ * @brief Updates 64 channels at once.
+ * @param arr Pointer to the EdgeArray instance.
+ * @param word Word index (channels 64*word .. 64*word+63).
+ * @param sample Current samples of those channels (bit N = channel 64*word+N).
+ * @return Mask of the channels that changed.
+ *
+ * @details
+ * Same semantics as `edge_update()` per channel. Only the counters of the
+ * changed channels are touched. Bits beyond `channels` are ignored.
+ */
+uint64_t edge_array_update_word(EdgeArray *arr, uint32_t word, uint64_t sample);
+
+/**
+ * @brief Applies pre-computed edge masks to 64 channels.
+ * @param arr Pointer to the EdgeArray instance.
+ * @param word Word index (channels 64*word .. 64*word+63).
+ * @param rising Channels with a rising edge.
+ * @param falling Channels with a falling edge.
+ * @param level Resulting level of the channels (becomes `prev`).
+ *
+ * @details
+ * Used by event-driven sources that already know the edges (see
+ * edge_pin_irq.h). A channel may have both a rising and a falling edge;
+ * the callback order then follows the channel's previous level.
+ */
+void edge_array_apply_masks(EdgeArray *arr, uint32_t word, uint64_t rising,
+                            uint64_t falling, uint64_t level);
+
+/**
+ * @brief Updates a single channel.
+ * @param arr Pointer to the EdgeArray instance.
+ * @param channel Channel number.
+ * @param input Current signal value (0 or 1).
+ * @return EdgeType: EDGE_NONE, EDGE_RISING, or EDGE_FALLING.
+ */
+EdgeType edge_array_update(EdgeArray *arr, uint32_t channel, uint8_t input);
+
+/**
+ * @brief Resets the counters of all channels.
+ * @param arr Pointer to the EdgeArray instance.
+ */
+void edge_array_reset(EdgeArray *arr);
+
+/**
+ * @brief Retrieves the rising edge count of a channel.
+ * @param arr Pointer to the EdgeArray instance.
+ * @param channel Channel number.
+ * @return Number of rising edges detected, 0 for invalid arguments.
+ */
+uint32_t edge_array_get_rise_count(const EdgeArray *arr, uint32_t channel);
+
+/**
+ * @brief Retrieves the falling edge count of a channel.
+ * @param arr Pointer to the EdgeArray instance.
+ * @param channel Channel number.
+ * @return Number of falling edges detected, 0 for invalid arguments.
+ */
+uint32_t edge_array_get_fall_count(const EdgeArray *arr, uint32_t channel);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_ARRAY_H */
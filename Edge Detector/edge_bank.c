@@ -0,0 +1,109 @@
+/**
+ * @file    edge_bank.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of bit-parallel edge detection banks.
+ * @license MIT
+ *
+ * @details
+ * Every bit of the port word is an independent detector; the rising and
+ * falling masks are computed for all of them at once, with no per-signal
+ * branches.
+ */
+
+#include "edge_bank.h"
+
+void edge_bank32_init(EdgeBank32 *bank, uint32_t initial_sample)
+{
+    if (!bank) return;
+    bank->prev     = initial_sample;
+    bank->rising   = 0u;
+    bank->falling  = 0u;
+    bank->on_edges = 0; /* No callback by default */
+    bank->ctx      = 0;
+#if defined(CLIB_INSTRUMENTATION)
+    bank->stats    = 0;
+#endif
+}
+
+void edge_bank32_set_callback(EdgeBank32 *bank, EdgeBank32Callback fn, void *ctx)
+{
+    if (!bank) return;
+    bank->on_edges = fn;
+    bank->ctx      = ctx;
+}
+
+uint32_t edge_bank32_update(EdgeBank32 *bank, uint32_t port_sample)
+{
+    if (!bank) return 0u;
+    CLIB_STATS_BEGIN(bank->stats, t0);
+
+    uint32_t prev = bank->prev;
+    uint32_t changed = prev ^ port_sample;
+    bank->rising  = ~prev & port_sample;
+    bank->falling = prev & ~port_sample;
+    bank->prev    = port_sample;
+
+    if (changed && bank->on_edges) {
+        CLIB_STATS_BEGIN(bank->stats, t1);
+        bank->on_edges(bank->ctx, bank->rising, bank->falling);
+        CLIB_STATS_CALLBACK_END(bank->stats, t1);
+    }
+    CLIB_STATS_END(bank->stats, t0);
+    return changed;
+}
+
+void edge_bank64_init(EdgeBank64 *bank, uint64_t initial_sample)
+{
+    if (!bank) return;
+    bank->prev     = initial_sample;
+    bank->rising   = 0u;
+    bank->falling  = 0u;
+    bank->on_edges = 0; /* No callback by default */
+    bank->ctx      = 0;
+#if defined(CLIB_INSTRUMENTATION)
+    bank->stats    = 0;
+#endif
+}
+
+void edge_bank64_set_callback(EdgeBank64 *bank, EdgeBank64Callback fn, void *ctx)
+{
+    if (!bank) return;
+    bank->on_edges = fn;
+    bank->ctx      = ctx;
+}
+
+uint64_t edge_bank64_update(EdgeBank64 *bank, uint64_t port_sample)
+{
+    if (!bank) return 0u;
+    CLIB_STATS_BEGIN(bank->stats, t0);
+
+    uint64_t prev = bank->prev;
+    uint64_t changed = prev ^ port_sample;
+    bank->rising  = ~prev & port_sample;
+    bank->falling = prev & ~port_sample;
+    bank->prev    = port_sample;
+
+    if (changed && bank->on_edges) {
+        CLIB_STATS_BEGIN(bank->stats, t1);
+        bank->on_edges(bank->ctx, bank->rising, bank->falling);
+        CLIB_STATS_CALLBACK_END(bank->stats, t1);
+    }
+    CLIB_STATS_END(bank->stats, t0);
+    return changed;
+}
+
+#if defined(CLIB_INSTRUMENTATION)
+void edge_bank32_attach_stats(EdgeBank32 *bank, ClibStats *stats)
+{
+    if (!bank) return;
+    bank->stats = stats;
+}
+
+void edge_bank64_attach_stats(EdgeBank64 *bank, ClibStats *stats)
+{
+    if (!bank) return;
+    bank->stats = stats;
+}
+#endif
@@ -0,0 +1,221 @@
+/**
+ * @file    edge_bank.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Bit-parallel edge detection for whole GPIO ports.
+ * @license MIT
+ *
+ * @details
+ * An EdgeBank tracks 32 or 64 binary signals packed into one machine word,
+ * with bit N holding signal N. One update computes the rising and falling
+ * masks of the whole port with two bitwise operations, so a raw GPIO input
+ * register can be passed in directly.
+ *
+ * Typical usage:
+ * @code
+ * EdgeBank32 port_a;
+ * edge_bank32_init(&port_a, GPIOA->IDR);
+ * while (1) {
+ *     if (edge_bank32_update(&port_a, GPIOA->IDR)) {
+ *         uint32_t pressed  = edge_bank32_rising(&port_a);
+ *         uint32_t released = edge_bank32_falling(&port_a);
+ *         ...
+ *     }
+ * }
+ * @endcode
+ */
+
+#ifndef EDGE_BANK_H
+#define EDGE_BANK_H
+
+#include <stdint.h>
+
+#include "../Common/clib_instrument.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct EdgeBank32
+ * @brief Edge state of up to 32 signals packed into one word.
+ *
+ * @var EdgeBank32::prev
+ *      Previous port sample, one bit per signal.
+ * @var EdgeBank32::rising
+ *      Signals that went 0 → 1 during the last update.
+ * @var EdgeBank32::falling
+ *      Signals that went 1 → 0 during the last update.
+ * @var EdgeBank32::on_edges
+ *      Optional batched callback, invoked once per update with edges.
+ * @var EdgeBank32::ctx
+ *      User context passed to `on_edges`.
+ * @var EdgeBank32::stats
+ *      Optional cycle statistics (only with CLIB_INSTRUMENTATION).
+ */
+typedef void (*EdgeBank32Callback)(void *ctx, uint32_t rising, uint32_t falling);
+
+typedef struct {
+    uint32_t prev;      /**< Previous port sample. */
+    uint32_t rising;    /**< Rising edge mask of the last update. */
+    uint32_t falling;   /**< Falling edge mask of the last update. */
+    EdgeBank32Callback on_edges;    /**< Optional batched callback. */
+    void *ctx;          /**< Context for `on_edges`. */
+#if defined(CLIB_INSTRUMENTATION)
+    ClibStats *stats;   /**< Optional cycle statistics (see clib_instrument.h). */
+#endif
+} EdgeBank32;
+
+/**
+ * @struct EdgeBank64
+ * @brief Edge state of up to 64 signals packed into one word.
+ *
+ * @var EdgeBank64::prev
+ *      Previous port sample, one bit per signal.
+ * @var EdgeBank64::rising
+ *      Signals that went 0 → 1 during the last update.
+ * @var EdgeBank64::falling
+ *      Signals that went 1 → 0 during the last update.
+ * @var EdgeBank64::on_edges
+ *      Optional batched callback, invoked once per update with edges.
+ * @var EdgeBank64::ctx
+ *      User context passed to `on_edges`.
+ * @var EdgeBank64::stats
+ *      Optional cycle statistics (only with CLIB_INSTRUMENTATION).
+ */
+typedef void (*EdgeBank64Callback)(void *ctx, uint64_t rising, uint64_t falling);
+
+typedef struct {
+    uint64_t prev;      /**< Previous port sample. */
+    uint64_t rising;    /**< Rising edge mask of the last update. */
+    uint64_t falling;   /**< Falling edge mask of the last update. */
+    EdgeBank64Callback on_edges;    /**< Optional batched callback. */
+    void *ctx;          /**< Context for `on_edges`. */
+#if defined(CLIB_INSTRUMENTATION)
+    ClibStats *stats;   /**< Optional cycle statistics (see clib_instrument.h). */
+#endif
+} EdgeBank64;
+
+/**
+ * @brief Initializes a 32-signal bank and synchronizes it with the port.
+ * @param bank Pointer to the EdgeBank32 instance.
+ * @param initial_sample Current port sample (bit N = signal N).
+ */
+void edge_bank32_init(EdgeBank32 *bank, uint32_t initial_sample);
+
+/**
+ * @brief Updates a 32-signal bank with a new port sample.
+ * @param bank Pointer to the EdgeBank32 instance.
+ * @param port_sample Current port sample (bit N = signal N).
+ * @return Mask of all signals that changed (rising | falling).
+ *
+ * @details
+ * - rising  = ~prev &  port_sample
+ * - falling =  prev & ~port_sample
+ * - Both masks stay available in the bank until the next update.
+ * - If `on_edges` is assigned it is called once with both masks when at
+ *   least one signal changed, instead of once per edge.
+ */
+uint32_t edge_bank32_update(EdgeBank32 *bank, uint32_t port_sample);
+
+/**
+ * @brief Assigns the batched edge callback of a 32-signal bank.
+ * @param bank Pointer to the EdgeBank32 instance.
+ * @param fn Callback, or NULL to remove it.
+ * @param ctx User context passed back on every call.
+ */
+void edge_bank32_set_callback(EdgeBank32 *bank, EdgeBank32Callback fn, void *ctx);
+
+/**
+ * @brief Initializes a 64-signal bank and synchronizes it with the port.
+ * @param bank Pointer to the EdgeBank64 instance.
+ * @param initial_sample Current port sample (bit N = signal N).
+ */
+void edge_bank64_init(EdgeBank64 *bank, uint64_t initial_sample);
+
+/**
+ * @brief Updates a 64-signal bank with a new port sample.
+ * @param bank Pointer to the EdgeBank64 instance.
+ * @param port_sample Current port sample (bit N = signal N).
+ * @return Mask of all signals that changed (rising | falling).
+ */
+uint64_t edge_bank64_update(EdgeBank64 *bank, uint64_t port_sample);
+
+/**
+ * @brief Assigns the batched edge callback of a 64-signal bank.
+ * @param bank Pointer to the EdgeBank64 instance.
+ * @param fn Callback, or NULL to remove it.
+ * @param ctx User context passed back on every call.
+ */
+void edge_bank64_set_callback(EdgeBank64 *bank, EdgeBank64Callback fn, void *ctx);
+
+#if defined(CLIB_INSTRUMENTATION)
+/**
+ * @brief Attaches cycle statistics to a 32-signal bank.
+ * @param bank Pointer to the EdgeBank32 instance.
+ * @param stats Initialized statistics, or NULL to detach.
+ * @note Only available with CLIB_INSTRUMENTATION.
+ */
+void edge_bank32_attach_stats(EdgeBank32 *bank, ClibStats *stats);
+
+/**
+ * @brief Attaches cycle statistics to a 64-signal bank.
+ * @param bank Pointer to the EdgeBank64 instance.
+ * @param stats Initialized statistics, or NULL to detach.
+ * @note Only available with CLIB_INSTRUMENTATION.
+ */
+void edge_bank64_attach_stats(EdgeBank64 *bank, ClibStats *stats);
+#endif
+
+/**
+ * @brief Rising edge mask of the last update.
+ * @param bank Pointer to the EdgeBank32 instance.
+ */
+static inline uint32_t edge_bank32_rising(const EdgeBank32 *bank)
+{
+    return bank ? bank->rising : 0u;
+}
+
+/**
+ * @brief Falling edge mask of the last update.
+ * @param bank Pointer to the EdgeBank32 instance.
+ */
+static inline uint32_t edge_bank32_falling(const EdgeBank32 *bank)
+{
+    return bank ? bank->falling : 0u;
+}
+
+/**
+ * @brief Rising edge mask of the last update.
+ * @param bank Pointer to the EdgeBank64 instance.
+ */
+static inline uint64_t edge_bank64_rising(const EdgeBank64 *bank)
+{
+    return bank ? bank->rising : 0u;
+}
+
+/**
+ * @brief Falling edge mask of the last update.
+ * @param bank Pointer to the EdgeBank64 instance.
+ */
+static inline uint64_t edge_bank64_falling(const EdgeBank64 *bank)
+{
+    return bank ? bank->falling : 0u;
+}
+
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+/**
+ * @brief Width-generic update: dispatches on the bank type (C11).
+ */
+#define edge_bank_update(bank, port_sample)            \
+    _Generic((bank),                                   \
+        EdgeBank32 *: edge_bank32_update,              \
+        EdgeBank64 *: edge_bank64_update)((bank), (port_sample))
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_BANK_H */
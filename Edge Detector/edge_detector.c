@@ -13,80 +13,237 @@
  */
 
 #include "edge_detector.h"
+#include "edge_event_queue.h"
+#include "edge_simd.h"
+#include "../Common/bit_ops.h"
 
-/**
- * @brief Normalize any value to strictly 0 or 1.
- * @param x Raw input value.
- * @return 0 if x==0, otherwise 1.
- */
-static inline uint8_t norm01(uint8_t x)
-{
-    return (x != 0u) ? 1u : 0u;
-}
+/* Out-of-line definitions of the hot path, unless the header inlines them. */
+#if !defined(EDGE_DETECTOR_INLINE)
+#include "edge_detector_inline.h"
+#endif
 
 void edge_init(EdgeDetector *det, uint8_t initial_state)
 {
     if (!det) return;
-    det->prev = norm01(initial_state);
+    det->prev = _edge_norm01(initial_state);
     det->rise_count = 0u;
     det->fall_count = 0u;
+    det->seq = 0u;
     det->on_edge = 0; /* No callback by default */
+    det->hooks = 0;   /* No hooks by default */
+#if defined(CLIB_INSTRUMENTATION)
+    det->stats = 0;
+#endif
 }
 
-/**
- * @brief Safely calls user callback if assigned.
- */
-static inline void _edge_invoke_callback(EdgeDetector *det, EdgeType type)
+void edge_attach_hooks(EdgeDetector *det, EdgeHooks *hooks)
+{
+    if (!det) return;
+    if (hooks) {
+        hooks->on_edge_ctx = 0;
+        hooks->ctx = 0;
+        hooks->queue = 0;
+        hooks->timing = 0;
+        hooks->history = 0;
+        hooks->callback_id = 0u;
+        hooks->queue_id = 0u;
+        hooks->clock = 0u;
+    }
+    det->hooks = hooks;
+}
+
+void edge_set_callback(EdgeDetector *det, EdgeCallback fn, void *ctx, uint32_t signal_id)
+{
+    if (!det || !det->hooks) return;
+    det->hooks->on_edge_ctx = fn;
+    det->hooks->ctx = ctx;
+    det->hooks->callback_id = signal_id;
+}
+
+void edge_attach_queue(EdgeDetector *det, struct EdgeEventQueue *queue, uint32_t signal_id)
+{
+    if (!det || !det->hooks) return;
+    det->hooks->queue = queue;
+    det->hooks->queue_id = signal_id;
+}
+
+void edge_attach_timing(EdgeDetector *det, struct EdgeTiming *timing)
+{
+    if (!det || !det->hooks) return;
+    det->hooks->timing = timing;
+}
+
+void edge_attach_history(EdgeDetector *det, struct EdgeHistory *history)
+{
+    if (!det || !det->hooks) return;
+    det->hooks->history = history;
+}
+
+#if defined(CLIB_INSTRUMENTATION)
+void edge_attach_stats(EdgeDetector *det, ClibStats *stats)
 {
-    if (det && det->on_edge)
-        det->on_edge(type);
+    if (!det) return;
+    det->stats = stats;
+}
+#endif
+
+/* Timestamp of the next sample processed without an explicit one. */
+static inline uint32_t _edge_clock(const EdgeDetector *det)
+{
+    return (det && det->hooks) ? det->hooks->clock : 0u;
+}
+
+size_t edge_update_buffer(EdgeDetector *det, const uint8_t *samples, size_t n,
+                          size_t *edge_indices, size_t max_indices)
+{
+    return edge_update_buffer_at(det, samples, n, edge_indices, max_indices, _edge_clock(det));
 }
 
-EdgeType edge_update(EdgeDetector *det, uint8_t input)
+size_t edge_update_buffer_at(EdgeDetector *det, const uint8_t *samples, size_t n,
+                             size_t *edge_indices, size_t max_indices, uint32_t base_ts)
 {
-    if (!det) return EDGE_NONE;
+    if (!det || !samples) return 0u;
 
-    uint8_t current = norm01(input);
-    EdgeType detected = EDGE_NONE;
+    uint8_t prev = det->prev;
+    size_t rises = 0u;
+    size_t falls = 0u;
 
-    if ((det->prev == 0u) && (current == 1u)) {
-        detected = EDGE_RISING;
-        det->rise_count++;
-        _edge_invoke_callback(det, EDGE_RISING);
+    if (!det->on_edge && !det->hooks && !edge_indices) {
+        /*
+         * Fast path: only the number of level changes is needed. Edges of a
+         * binary signal alternate, so the first one is rising iff prev == 0.
+         */
+        size_t transitions = edge_simd_count_transitions(prev, samples, n);
+        size_t first = (transitions + 1u) / 2u;
+        size_t second = transitions / 2u;
+        rises = prev ? second : first;
+        falls = prev ? first : second;
+        prev ^= (uint8_t)(transitions & 1u);
+        _edge_seq_begin(det);
+        _edge_count_add(&det->rise_count, (edge_count_t)rises);
+        _edge_count_add(&det->fall_count, (edge_count_t)falls);
+        _edge_seq_end(det);
     }
-    else if ((det->prev == 1u) && (current == 0u)) {
-        detected = EDGE_FALLING;
-        det->fall_count++;
-        _edge_invoke_callback(det, EDGE_FALLING);
+    else {
+        /* Counters are kept current for callbacks that read them. */
+        size_t stored = 0u;
+        for (size_t i = 0; i < n; i++) {
+            uint8_t current = _edge_norm01(samples[i]);
+            if (current != prev) {
+                EdgeType type = current ? EDGE_RISING : EDGE_FALLING;
+                if (current) rises++;
+                else         falls++;
+                _edge_seq_begin(det);
+                _edge_count_add(current ? &det->rise_count : &det->fall_count, 1u);
+                _edge_seq_end(det);
+                if (edge_indices && stored < max_indices)
+                    edge_indices[stored++] = i;
+                _edge_invoke_callback(det, type, base_ts + (uint32_t)i);
+            }
+            prev = current;
+        }
     }
 
-    det->prev = current;
-    return detected;
+    det->prev = prev;
+    if (det->hooks) det->hooks->clock = base_ts + (uint32_t)n;
+    return rises + falls;
 }
 
-uint8_t edge_both(EdgeDetector *det, uint8_t input)
+size_t edge_update_packed(EdgeDetector *det, const uint8_t *bits, size_t nbits,
+                          size_t *edge_indices, size_t max_indices)
 {
-    if (!det) return 0u;
+    return edge_update_packed_at(det, bits, nbits, edge_indices, max_indices, _edge_clock(det));
+}
+
+size_t edge_update_packed_at(EdgeDetector *det, const uint8_t *bits, size_t nbits,
+                             size_t *edge_indices, size_t max_indices, uint32_t base_ts)
+{
+    if (!det || !bits) return 0u;
+
+    uint64_t prev = det->prev;
+    size_t total = 0u;
+    size_t total_rises = 0u;
+    size_t stored = 0u;
+    uint8_t per_edge = (det->on_edge != 0) || (det->hooks != 0) || (edge_indices != 0);
 
-    EdgeType type = edge_update(det, input);
-    return (type != EDGE_NONE) ? 1u : 0u;
+    for (size_t base = 0; base < nbits; base += 64u) {
+        size_t left = nbits - base;
+        unsigned valid = (left >= 64u) ? 64u : (unsigned)left;
+        uint64_t w = bit_load_le64(bits + base / 8u, (valid + 7u) / 8u) & bit_mask64(valid);
+
+        /* Bit i set where sample i differs from sample i-1. Edges alternate,
+         * so rises - falls is the last level minus the one carried in. */
+        uint64_t changed = (w ^ ((w << 1) | prev)) & bit_mask64(valid);
+        uint64_t last = (w >> (valid - 1u)) & 1u;
+        uint32_t edges = bit_popcount64(changed);
+        uint32_t rises = (uint32_t)((edges + last - prev) / 2u);
+        uint32_t falls = edges - rises;
+        prev = last;
+
+        if (!per_edge) {
+            total_rises += rises;
+        }
+        else {
+            while (changed) {
+                unsigned bit = bit_ctz64(changed);
+                changed &= changed - 1u;
+                _edge_seq_begin(det);
+                _edge_count_add(((w >> bit) & 1u) ? &det->rise_count : &det->fall_count, 1u);
+                _edge_seq_end(det);
+                if (edge_indices && stored < max_indices)
+                    edge_indices[stored++] = base + bit;
+                _edge_invoke_callback(det, ((w >> bit) & 1u) ? EDGE_RISING : EDGE_FALLING,
+                                      base_ts + (uint32_t)(base + bit));
+            }
+        }
+        total += (size_t)rises + (size_t)falls;
+    }
+
+    if (!per_edge && total) {
+        /* Counters are committed once for the whole stream. */
+        _edge_seq_begin(det);
+        _edge_count_add(&det->rise_count, (edge_count_t)total_rises);
+        _edge_count_add(&det->fall_count, (edge_count_t)(total - total_rises));
+        _edge_seq_end(det);
+    }
+
+    det->prev = (uint8_t)prev;
+    if (det->hooks) det->hooks->clock = base_ts + (uint32_t)nbits;
+    return total;
 }
 
 void edge_reset(EdgeDetector *det)
 {
     if (!det) return;
+    _edge_seq_begin(det);
     det->rise_count = 0u;
     det->fall_count = 0u;
+    _edge_seq_end(det);
 }
 
-uint32_t edge_get_rise_count(const EdgeDetector *det)
+edge_count_t edge_get_rise_count(const EdgeDetector *det)
 {
     if (!det) return 0u;
     return det->rise_count;
 }
 
-uint32_t edge_get_fall_count(const EdgeDetector *det)
+edge_count_t edge_get_fall_count(const EdgeDetector *det)
 {
     if (!det) return 0u;
     return det->fall_count;
 }
+
+uint32_t edge_snapshot(const EdgeDetector *det, EdgeSnapshot *out)
+{
+    if (!det || !out) return 0u;
+
+    uint32_t retries = 0u;
+    for (;;) {
+        uint32_t before = clib_load_acquire32(&det->seq);
+        out->rise_count = det->rise_count;
+        out->fall_count = det->fall_count;
+        clib_fence_acquire();
+        if (!(before & 1u) && det->seq == before) return retries;
+        retries++;
+    }
+}
@@ -26,12 +26,55 @@
 #ifndef EDGE_DETECTOR_H
 #define EDGE_DETECTOR_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "../Common/clib_instrument.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @def EDGE_HOT_API
+ * @brief Linkage of the hot-path functions (`edge_update()`,
+ *        `edge_update_at()`, `edge_both()`).
+ *
+ * Define `EDGE_DETECTOR_INLINE` (for the library and all its users) to
+ * make them `static inline` in this header; by default they are regular
+ * functions of edge_detector.c.
+ *
+ * Define `EDGE_DETECTOR_USE_LUT` to classify edges through a 4-entry table
+ * indexed by `(prev << 1) | current` instead of branches (same results).
+ */
+#if defined(EDGE_DETECTOR_INLINE)
+#define EDGE_HOT_API static inline
+#else
+#define EDGE_HOT_API
+#endif
+
+/**
+ * @def EDGE_COUNTER_BITS
+ * @brief Width of the edge counters: 32 (default) or 64.
+ *
+ * @def EDGE_COUNTER_SATURATE
+ * @brief Define to make the counters stop at their maximum instead of
+ *        wrapping around.
+ */
+#ifndef EDGE_COUNTER_BITS
+#define EDGE_COUNTER_BITS 32
+#endif
+
+#if EDGE_COUNTER_BITS == 64
+typedef uint64_t edge_count_t;  /**< Edge counter type. */
+#define EDGE_COUNT_MAX UINT64_MAX
+#elif EDGE_COUNTER_BITS == 32
+typedef uint32_t edge_count_t;  /**< Edge counter type. */
+#define EDGE_COUNT_MAX UINT32_MAX
+#else
+#error "EDGE_COUNTER_BITS must be 32 or 64"
+#endif
+
 /**
  * @enum EdgeType
  * @brief Enumerates detected edge types.
@@ -43,26 +86,100 @@ typedef enum {
     EDGE_BOTH        /**< Any change (0 ↔ 1) */
 } EdgeType;
 
+struct EdgeEventQueue;
+struct EdgeTiming;
+struct EdgeHistory;
+
+/**
+ * @brief Context-carrying edge callback.
+ * @param ctx User context given to `edge_set_callback()`.
+ * @param type EDGE_RISING or EDGE_FALLING.
+ * @param id Signal id given to `edge_set_callback()`.
+ */
+typedef void (*EdgeCallback)(void *ctx, EdgeType type, uint32_t id);
+
+/**
+ * @struct EdgeHooks
+ * @brief Optional per-edge consumers of one detector.
+ *
+ * @var EdgeHooks::on_edge_ctx
+ *      Optional callback receiving a user context and the signal id.
+ * @var EdgeHooks::ctx
+ *      User context passed to `on_edge_ctx`.
+ * @var EdgeHooks::queue
+ *      Optional event queue receiving one record per edge.
+ * @var EdgeHooks::timing
+ *      Optional pulse-width/period statistics updated on every edge.
+ * @var EdgeHooks::history
+ *      Optional compact log receiving every edge.
+ * @var EdgeHooks::callback_id
+ *      Signal id passed to `on_edge_ctx` (see `edge_set_callback()`).
+ * @var EdgeHooks::queue_id
+ *      Signal id stored in queued events (see `edge_attach_queue()`).
+ * @var EdgeHooks::clock
+ *      Sample clock: timestamp of the next sample processed without an
+ *      explicit one (see `edge_update()`).
+ *
+ * Caller-provided and attached with `edge_attach_hooks()`, so that the
+ * detectors that use none of them only pay for one pointer.
+ */
+typedef struct EdgeHooks {
+    EdgeCallback on_edge_ctx;       /**< Optional context callback. */
+    void *ctx;                      /**< Context for `on_edge_ctx`. */
+    struct EdgeEventQueue *queue;   /**< Optional event queue (see edge_event_queue.h). */
+    struct EdgeTiming *timing;      /**< Optional timing statistics (see edge_timing.h). */
+    struct EdgeHistory *history;    /**< Optional edge log (see edge_history.h). */
+    uint32_t callback_id;           /**< Signal id passed to `on_edge_ctx`. */
+    uint32_t queue_id;              /**< Signal id of queued events. */
+    uint32_t clock;                 /**< Timestamp of the next untimed sample. */
+} EdgeHooks;
+
 /**
  * @struct EdgeDetector
  * @brief Maintains state and statistics for one binary signal.
  *
- * @var EdgeDetector::prev
- *      Previous normalized input (0 or 1).
+ * @var EdgeDetector::on_edge
+ *      Optional user callback triggered on edge events.
+ * @var EdgeDetector::hooks
+ *      Optional context callback, event queue, timing and history
+ *      (see `edge_attach_hooks()`).
+ * @var EdgeDetector::stats
+ *      Optional cycle statistics (only with CLIB_INSTRUMENTATION).
  * @var EdgeDetector::rise_count
  *      Total number of rising edges detected.
  * @var EdgeDetector::fall_count
  *      Total number of falling edges detected.
- * @var EdgeDetector::on_edge
- *      Optional user callback triggered on edge events.
+ * @var EdgeDetector::seq
+ *      Sequence counter, odd while the counters are being written
+ *      (see `edge_snapshot()`).
+ * @var EdgeDetector::prev
+ *      Previous normalized input (0 or 1).
+ *
+ * Members are ordered by decreasing alignment so that no padding is
+ * inserted between them: 32 bytes on LP64 hosts, 24 on 32-bit targets
+ * (with 32-bit counters). For thousands of signals see edge_array.h.
  */
 typedef struct {
-    uint8_t prev;           /**< Previous normalized input (0 or 1). */
-    uint32_t rise_count;    /**< Counter for rising edges. */
-    uint32_t fall_count;    /**< Counter for falling edges. */
     void (*on_edge)(EdgeType type); /**< Optional callback function pointer. */
+    EdgeHooks *hooks;               /**< Optional hooks (see edge_attach_hooks()). */
+#if defined(CLIB_INSTRUMENTATION)
+    ClibStats *stats;       /**< Optional cycle statistics (see clib_instrument.h). */
+#endif
+    edge_count_t rise_count;        /**< Counter for rising edges. */
+    edge_count_t fall_count;        /**< Counter for falling edges. */
+    volatile uint32_t seq;  /**< Counter sequence (seqlock). */
+    uint8_t prev;           /**< Previous normalized input (0 or 1). */
 } EdgeDetector;
 
+/**
+ * @struct EdgeSnapshot
+ * @brief Consistent copy of the counters of a detector.
+ */
+typedef struct {
+    edge_count_t rise_count;        /**< Rising edges. */
+    edge_count_t fall_count;        /**< Falling edges. */
+} EdgeSnapshot;
+
 /**
  * @brief Initializes or re-initializes the detector.
  * @param det Pointer to the EdgeDetector instance.
@@ -80,10 +197,27 @@ void edge_init(EdgeDetector *det, uint8_t initial_state);
  * @details
  * - Detects transitions between consecutive samples.
  * - Automatically increments internal counters.
- * - Triggers callback (`on_edge`) if assigned.
+ * - Triggers callbacks (`on_edge`, `on_edge_ctx`) and hooks if assigned.
  * - Thread-safe under single access per instance.
+ *
+ * With hooks attached, the sample is stamped with the sample clock
+ * `hooks->clock`. Every processed sample advances the clock to its own
+ * timestamp + 1, so untimed calls continue the time base of the last
+ * timed call (or count samples from 0), whichever API the samples of one
+ * stream go through.
+ */
+EDGE_HOT_API EdgeType edge_update(EdgeDetector *det, uint8_t input);
+
+/**
+ * @brief Same as `edge_update()`, with a timestamp for queued events.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param input Current signal value (0 or 1).
+ * @param timestamp Time of the sample (timer ticks, sample counter, ...).
+ * @return EdgeType: EDGE_NONE, EDGE_RISING, or EDGE_FALLING.
+ *
+ * @note Sets the sample clock to `timestamp + 1` (see `edge_update()`).
  */
-EdgeType edge_update(EdgeDetector *det, uint8_t input);
+EDGE_HOT_API EdgeType edge_update_at(EdgeDetector *det, uint8_t input, uint32_t timestamp);
 
 /**
  * @brief Checks for any edge (rising or falling).
@@ -92,7 +226,166 @@ EdgeType edge_update(EdgeDetector *det, uint8_t input);
  * @return 1 if the signal changed, otherwise 0.
  * @note Internally calls `edge_update()`.
  */
-uint8_t edge_both(EdgeDetector *det, uint8_t input);
+EDGE_HOT_API uint8_t edge_both(EdgeDetector *det, uint8_t input);
+
+/**
+ * @brief Processes a whole buffer of samples in one call.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param samples Buffer of signal values (0 or non-zero), oldest first.
+ * @param n Number of samples in the buffer.
+ * @param edge_indices Optional output array for the buffer index of every
+ *        detected edge (may be NULL).
+ * @param max_indices Capacity of `edge_indices`; further edges are still
+ *        counted but their indices are not stored.
+ * @return Number of edges (rising + falling) detected in the buffer.
+ *
+ * @details
+ * - Equivalent to calling `edge_update()` once per sample.
+ * - `prev` is carried across calls, so consecutive buffers of one capture
+ *   form a continuous stream.
+ * - The edge type at index i is `samples[i] ? EDGE_RISING : EDGE_FALLING`.
+ * - Counters are updated in bulk; the callbacks and hooks are still
+ *   served once per edge if assigned.
+ * - Without `on_edge`, hooks and index output, the buffer is scanned by a
+ *   SIMD kernel (AVX2/SSE2/NEON, see edge_simd.h) with identical results.
+ * - Sample i is stamped `clock + i` with the sample clock of the hooks
+ *   (see `edge_update()`), which then advances by `n`.
+ */
+size_t edge_update_buffer(EdgeDetector *det, const uint8_t *samples, size_t n,
+                          size_t *edge_indices, size_t max_indices);
+
+/**
+ * @brief Same as `edge_update_buffer()`, with the timestamp of the first sample.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param samples Buffer of signal values (0 or non-zero), oldest first.
+ * @param n Number of samples in the buffer.
+ * @param edge_indices Optional output array for the buffer index of every edge.
+ * @param max_indices Capacity of `edge_indices`.
+ * @param base_ts Timestamp of `samples[0]`; sample i is stamped `base_ts + i`.
+ * @return Number of edges (rising + falling) detected in the buffer.
+ *
+ * @details
+ * For DMA captures with a hardware timestamp per buffer. Sets the sample
+ * clock to `base_ts + n`.
+ */
+size_t edge_update_buffer_at(EdgeDetector *det, const uint8_t *samples, size_t n,
+                             size_t *edge_indices, size_t max_indices, uint32_t base_ts);
+
+/**
+ * @brief Processes a bit-packed sample stream in one call.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param bits Packed samples, 1 bit per sample, LSB-first
+ *        (sample i is bit (i % 8) of bits[i / 8]).
+ * @param nbits Number of samples in the stream.
+ * @param edge_indices Optional output array for the sample index of every
+ *        detected edge (may be NULL).
+ * @param max_indices Capacity of `edge_indices`.
+ * @return Number of edges (rising + falling) detected in the stream.
+ *
+ * @details
+ * Same semantics as `edge_update_buffer()`: `prev` is carried across calls
+ * and word boundaries. The stream is processed 64 samples at a time with an
+ * XOR against the word shifted by one sample plus a popcount. Samples are
+ * stamped with the sample clock like `edge_update_buffer()`.
+ */
+size_t edge_update_packed(EdgeDetector *det, const uint8_t *bits, size_t nbits,
+                          size_t *edge_indices, size_t max_indices);
+
+/**
+ * @brief Same as `edge_update_packed()`, with the timestamp of the first sample.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param bits Packed samples, 1 bit per sample, LSB-first.
+ * @param nbits Number of samples in the stream.
+ * @param edge_indices Optional output array for the sample index of every edge.
+ * @param max_indices Capacity of `edge_indices`.
+ * @param base_ts Timestamp of sample 0; sample i is stamped `base_ts + i`.
+ * @return Number of edges (rising + falling) detected in the stream.
+ * @note Sets the sample clock to `base_ts + nbits`.
+ */
+size_t edge_update_packed_at(EdgeDetector *det, const uint8_t *bits, size_t nbits,
+                             size_t *edge_indices, size_t max_indices, uint32_t base_ts);
+
+/**
+ * @brief Attaches (or detaches) the storage of the optional hooks.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param hooks Hook block, cleared here, or NULL to detach all hooks.
+ *
+ * @details
+ * `edge_set_callback()`, `edge_attach_queue()`, `edge_attach_timing()` and
+ * `edge_attach_history()` store into this block and are ignored while no
+ * block is attached. One block serves one detector.
+ */
+void edge_attach_hooks(EdgeDetector *det, EdgeHooks *hooks);
+
+/**
+ * @brief Assigns a context-carrying callback.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param fn Callback, or NULL to remove it.
+ * @param ctx User context passed back on every edge.
+ * @param signal_id Id passed back on every edge (independent of the
+ *        queue's id, see `edge_attach_queue()`).
+ *
+ * @details
+ * Lets many detectors share one handler without trampolines: the handler
+ * knows from `ctx`/`id` which signal fired. Called after `on_edge`.
+ * @note Needs hook storage, see `edge_attach_hooks()`.
+ */
+void edge_set_callback(EdgeDetector *det, EdgeCallback fn, void *ctx, uint32_t signal_id);
+
+/**
+ * @brief Attaches an event queue to the detector.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param queue Initialized queue, or NULL to detach.
+ * @param signal_id Id stored in every event of this detector (independent
+ *        of the callback's id).
+ *
+ * @details
+ * Every detected edge is pushed as `{timestamp, signal_id, type}`, in
+ * addition to the `on_edge` callback. The timestamp is the one given to the
+ * `_at` calls, or the sample clock (see `edge_update()`).
+ * @note Needs hook storage, see `edge_attach_hooks()`.
+ */
+void edge_attach_queue(EdgeDetector *det, struct EdgeEventQueue *queue, uint32_t signal_id);
+
+/**
+ * @brief Attaches pulse-width/period statistics to the detector.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param timing Initialized statistics, or NULL to detach.
+ *
+ * @details
+ * Every detected edge updates `timing` with the timestamp of its sample,
+ * as given to the `_at` calls or taken from the sample clock (see
+ * `edge_update()`), so periods spanning several buffers are measured
+ * correctly.
+ * @note Needs hook storage, see `edge_attach_hooks()`.
+ */
+void edge_attach_timing(EdgeDetector *det, struct EdgeTiming *timing);
+
+/**
+ * @brief Attaches a compact edge log to the detector.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param history Initialized log, or NULL to detach.
+ *
+ * @details
+ * Every detected edge is appended to `history` with the timestamp of its
+ * sample, as given to the `_at` calls or taken from the sample clock (see
+ * `edge_update()`), so logs fed from consecutive buffers stay continuous.
+ * @note Needs hook storage, see `edge_attach_hooks()`.
+ */
+void edge_attach_history(EdgeDetector *det, struct EdgeHistory *history);
+
+#if defined(CLIB_INSTRUMENTATION)
+/**
+ * @brief Attaches cycle statistics to the detector.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param stats Initialized statistics, or NULL to detach.
+ *
+ * @details
+ * `edge_update()` / `edge_update_at()` calls and the edge hooks they
+ * dispatch are recorded. Only available with CLIB_INSTRUMENTATION.
+ */
+void edge_attach_stats(EdgeDetector *det, ClibStats *stats);
+#endif
 
 /**
  * @brief Resets internal counters (rising/falling).
@@ -104,18 +397,40 @@ void edge_reset(EdgeDetector *det);
  * @brief Retrieves rising edge count.
  * @param det Pointer to the EdgeDetector instance.
  * @return Number of rising edges detected.
+ * @note Use `edge_snapshot()` from a context that can preempt the updater.
  */
-uint32_t edge_get_rise_count(const EdgeDetector *det);
+edge_count_t edge_get_rise_count(const EdgeDetector *det);
 
 /**
  * @brief Retrieves falling edge count.
  * @param det Pointer to the EdgeDetector instance.
  * @return Number of falling edges detected.
+ * @note Use `edge_snapshot()` from a context that can preempt the updater.
+ */
+edge_count_t edge_get_fall_count(const EdgeDetector *det);
+
+/**
+ * @brief Reads both counters consistently while another context updates them.
+ * @param det Pointer to the EdgeDetector instance.
+ * @param out Destination for the counters.
+ * @return Number of retries needed (0 if the first read was consistent).
+ *
+ * @details
+ * The updater (typically an ISR) makes `seq` odd while it writes the
+ * counters and even again afterwards; the reader retries until it sees
+ * the same even value before and after copying. Interrupts are never
+ * masked, and the updater does no extra work beyond two stores per edge.
+ * Call it from a context that the updater can run over (task or other
+ * core), not from one that blocks the updater.
  */
-uint32_t edge_get_fall_count(const EdgeDetector *det);
+uint32_t edge_snapshot(const EdgeDetector *det, EdgeSnapshot *out);
 
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
 
+#if defined(EDGE_DETECTOR_INLINE)
+#include "edge_detector_inline.h"
+#endif
+
 #endif /* EDGE_DETECTOR_H */
@@ -0,0 +1,141 @@
+/**
+ * @file    edge_detector.hpp
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Compile-time specialized edge detector for C++17.
+ * @license MIT
+ *
+ * @details
+ * `clib::EdgeDetector<CounterPolicy, CallbackPolicy>` has the semantics of
+ * `edge_update()` with the optional parts chosen at compile time: no NULL
+ * checks, no callback pointer, and counters only if requested. With
+ * `NoCounters` and `NoCallback` the detector is a single byte and an
+ * update is one compare.
+ *
+ * @code
+ * void on_button(EdgeType t);
+ *
+ * clib::EdgeDetector<> plain;                                       // counters only
+ * clib::EdgeDetector<clib::NoCounters, clib::Callback<on_button>> button;
+ * if (button.update(read_pin()) == EDGE_RISING) { ... }
+ * @endcode
+ *
+ * Existing C state can be loaded with the converting constructor and
+ * written back with `export_to()`, so both APIs can share one signal.
+ */
+
+#ifndef EDGE_DETECTOR_HPP
+#define EDGE_DETECTOR_HPP
+
+#include "edge_detector.h"
+#include "../Common/clib_policies.hpp"
+
+namespace clib {
+
+/**
+ * @brief Edge detector with compile-time features.
+ * @tparam CounterPolicy `Counters<T>` or `NoCounters`.
+ * @tparam CallbackPolicy Callable invoked as `cb(EdgeType)` on every edge;
+ *         `NoCallback`, `Callback<fn>` or any (preferably empty) functor.
+ */
+template <typename CounterPolicy = Counters<edge_count_t>, typename CallbackPolicy = NoCallback>
+class EdgeDetector : private CounterPolicy, private CallbackPolicy {
+public:
+    /** @brief True if the detector keeps edge counters. */
+    static constexpr bool counts = detail::is_counting<CounterPolicy>::value;
+
+    /**
+     * @brief Creates a detector (same as `edge_init()`).
+     * @param initial_state Initial signal state.
+     * @param cb Callback instance.
+     */
+    constexpr explicit EdgeDetector(bool initial_state = false,
+                                    CallbackPolicy cb = CallbackPolicy()) noexcept
+        : CounterPolicy(), CallbackPolicy(cb), prev_(initial_state) {}
+
+    /**
+     * @brief Takes over the state of a C detector (level and counters).
+     * @param c Initialized C detector; its callbacks are not copied.
+     * @param cb Callback instance.
+     */
+    explicit EdgeDetector(const ::EdgeDetector &c, CallbackPolicy cb = CallbackPolicy()) noexcept
+        : CounterPolicy(), CallbackPolicy(cb), prev_(c.prev != 0u)
+    {
+        if constexpr (counts) {
+            this->rises = c.rise_count;
+            this->falls = c.fall_count;
+        }
+    }
+
+    /**
+     * @brief Updates the detector (same as `edge_update()`).
+     * @param input Current signal value.
+     * @return EDGE_NONE, EDGE_RISING or EDGE_FALLING.
+     */
+    EdgeType update(bool input)
+    {
+        if (input == prev_) return EDGE_NONE;
+        prev_ = input;
+
+        const EdgeType type = input ? EDGE_RISING : EDGE_FALLING;
+        if constexpr (counts) {
+            if (input) ++this->rises;
+            else       ++this->falls;
+        }
+        static_cast<CallbackPolicy &>(*this)(type);
+        return type;
+    }
+
+    /**
+     * @brief Returns true on any edge (same as `edge_both()`).
+     * @param input Current signal value.
+     */
+    bool both(bool input) { return update(input) != EDGE_NONE; }
+
+    /** @brief Previous (current) signal level. */
+    constexpr bool level() const noexcept { return prev_; }
+
+    /** @brief Number of rising edges (requires a counter policy). */
+    constexpr auto rise_count() const noexcept
+    {
+        static_assert(counts, "rise_count() needs a Counters<> policy");
+        return this->rises;
+    }
+
+    /** @brief Number of falling edges (requires a counter policy). */
+    constexpr auto fall_count() const noexcept
+    {
+        static_assert(counts, "fall_count() needs a Counters<> policy");
+        return this->falls;
+    }
+
+    /** @brief Resets the counters (same as `edge_reset()`). */
+    void reset() noexcept
+    {
+        if constexpr (counts) {
+            this->rises = 0;
+            this->falls = 0;
+        }
+    }
+
+    /**
+     * @brief Writes level and counters into a C detector.
+     * @param c Initialized C detector; its callbacks and queue are kept.
+     */
+    void export_to(::EdgeDetector &c) const noexcept
+    {
+        c.prev = prev_ ? 1u : 0u;
+        if constexpr (counts) {
+            c.rise_count = static_cast<edge_count_t>(this->rises);
+            c.fall_count = static_cast<edge_count_t>(this->falls);
+        }
+    }
+
+private:
+    bool prev_;
+};
+
+} // namespace clib
+
+#endif /* EDGE_DETECTOR_HPP */
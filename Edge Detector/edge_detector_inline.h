@@ -0,0 +1,194 @@
+/**
+ * @file    edge_detector_inline.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Hot-path definitions of the edge detector.
+ * @license MIT
+ *
+ * @details
+ * Do not include directly. With `EDGE_DETECTOR_INLINE` defined, this file
+ * is pulled into every user of edge_detector.h and the functions below are
+ * `static inline`, so the compiler can inline them into the scan loop,
+ * drop the NULL checks for known detectors and fuse loops. Otherwise
+ * edge_detector.c includes it once to provide the regular external
+ * definitions.
+ */
+
+#ifndef EDGE_DETECTOR_INLINE_H
+#define EDGE_DETECTOR_INLINE_H
+
+#include "edge_detector.h"
+#include "edge_event_queue.h"
+#include "edge_history.h"
+#include "edge_timing.h"
+#include "../Common/clib_barrier.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Normalize any value to strictly 0 or 1.
+ * @param x Raw input value.
+ * @return 0 if x==0, otherwise 1.
+ */
+static inline uint8_t _edge_norm01(uint8_t x)
+{
+    return (x != 0u) ? 1u : 0u;
+}
+
+/**
+ * @brief Opens a counter write section (`seq` becomes odd).
+ */
+static inline void _edge_seq_begin(EdgeDetector *det)
+{
+    det->seq = det->seq + 1u;
+    clib_fence_release();
+}
+
+/**
+ * @brief Closes a counter write section (`seq` becomes even again).
+ */
+static inline void _edge_seq_end(EdgeDetector *det)
+{
+    clib_store_release32(&det->seq, det->seq + 1u);
+}
+
+/**
+ * @brief Adds `n` to a counter, wrapping or saturating (EDGE_COUNTER_SATURATE).
+ */
+static inline void _edge_count_add(edge_count_t *counter, edge_count_t n)
+{
+#if defined(EDGE_COUNTER_SATURATE)
+    edge_count_t room = EDGE_COUNT_MAX - *counter;
+    *counter = (n > room) ? EDGE_COUNT_MAX : (edge_count_t)(*counter + n);
+#else
+    *counter += n;
+#endif
+}
+
+/**
+ * @brief Safely calls user callback, queues the event and updates the
+ *        timing statistics and history if assigned.
+ */
+static inline void _edge_invoke_callback(EdgeDetector *det, EdgeType type, uint32_t timestamp)
+{
+    if (!det) return;
+    CLIB_STATS_BEGIN(det->stats, t0);
+    if (det->on_edge)
+        det->on_edge(type);
+    EdgeHooks *hooks = det->hooks;
+    if (hooks) {
+        if (hooks->on_edge_ctx)
+            hooks->on_edge_ctx(hooks->ctx, type, hooks->callback_id);
+        if (hooks->queue) {
+            EdgeEvent ev;
+            ev.timestamp = timestamp;
+            ev.signal_id = hooks->queue_id;
+            ev.type = (uint8_t)type;
+            edge_queue_push(hooks->queue, &ev);
+        }
+        if (hooks->timing)
+            edge_timing_record(hooks->timing, (uint8_t)(type == EDGE_RISING), timestamp);
+        if (hooks->history)
+            edge_history_record(hooks->history, (uint8_t)(type == EDGE_RISING), timestamp);
+    }
+    CLIB_STATS_CALLBACK_END(det->stats, t0);
+}
+
+EDGE_HOT_API EdgeType edge_update(EdgeDetector *det, uint8_t input)
+{
+    /* Without an explicit time the sample is stamped with the hooks' clock */
+    return edge_update_at(det, input, (det && det->hooks) ? det->hooks->clock : 0u);
+}
+
+#if defined(EDGE_DETECTOR_USE_LUT)
+
+/**
+ * @brief Edge classification indexed by (prev << 1) | current:
+ *        edge type, rising delta, falling delta.
+ */
+static const uint8_t _edge_lut[4][3] = {
+    { EDGE_NONE,    0u, 0u },   /* 0 -> 0 */
+    { EDGE_RISING,  1u, 0u },   /* 0 -> 1 */
+    { EDGE_FALLING, 0u, 1u },   /* 1 -> 0 */
+    { EDGE_NONE,    0u, 0u }    /* 1 -> 1 */
+};
+
+EDGE_HOT_API EdgeType edge_update_at(EdgeDetector *det, uint8_t input, uint32_t timestamp)
+{
+    if (!det) return EDGE_NONE;
+    CLIB_STATS_BEGIN(det->stats, t0);
+
+    uint8_t current = _edge_norm01(input);
+    const uint8_t *entry = _edge_lut[(det->prev << 1) | current];
+    EdgeType detected = (EdgeType)entry[0];
+
+    /* One branch on "edge or not"; the table selects the counter. */
+    if (detected != EDGE_NONE) {
+        _edge_seq_begin(det);
+        _edge_count_add(&det->rise_count, entry[1]);
+        _edge_count_add(&det->fall_count, entry[2]);
+        _edge_seq_end(det);
+    }
+    det->prev = current;
+
+    /* The hook test comes first: it is stable, the edge test is not. */
+    if (det->on_edge || det->hooks) {
+        if (detected != EDGE_NONE)
+            _edge_invoke_callback(det, detected, timestamp);
+        if (det->hooks)
+            det->hooks->clock = timestamp + 1u;
+    }
+    CLIB_STATS_END(det->stats, t0);
+    return detected;
+}
+
+#else
+
+EDGE_HOT_API EdgeType edge_update_at(EdgeDetector *det, uint8_t input, uint32_t timestamp)
+{
+    if (!det) return EDGE_NONE;
+    CLIB_STATS_BEGIN(det->stats, t0);
+
+    uint8_t current = _edge_norm01(input);
+    EdgeType detected = EDGE_NONE;
+
+    if ((det->prev == 0u) && (current == 1u)) {
+        detected = EDGE_RISING;
+        _edge_seq_begin(det);
+        _edge_count_add(&det->rise_count, 1u);
+        _edge_seq_end(det);
+        _edge_invoke_callback(det, EDGE_RISING, timestamp);
+    }
+    else if ((det->prev == 1u) && (current == 0u)) {
+        detected = EDGE_FALLING;
+        _edge_seq_begin(det);
+        _edge_count_add(&det->fall_count, 1u);
+        _edge_seq_end(det);
+        _edge_invoke_callback(det, EDGE_FALLING, timestamp);
+    }
+
+    det->prev = current;
+    if (det->hooks)
+        det->hooks->clock = timestamp + 1u;
+    CLIB_STATS_END(det->stats, t0);
+    return detected;
+}
+
+#endif /* EDGE_DETECTOR_USE_LUT */
+
+EDGE_HOT_API uint8_t edge_both(EdgeDetector *det, uint8_t input)
+{
+    if (!det) return 0u;
+
+    EdgeType type = edge_update(det, input);
+    return (type != EDGE_NONE) ? 1u : 0u;
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_DETECTOR_INLINE_H */
@@ -0,0 +1,92 @@
+/**
+ * @file    edge_event_queue.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the SPSC edge event queue.
+ * @license MIT
+ *
+ * @details
+ * Head and tail are free-running 32-bit indices; the fill level is their
+ * difference, so no slot is sacrificed to tell "full" from "empty". Each
+ * side publishes its index with release semantics after touching the
+ * slots, and reads the other side's index with acquire semantics.
+ */
+
+#include "edge_event_queue.h"
+#include "../Common/clib_barrier.h"
+
+/* The slot copies are plain accesses, ordered by the barriers of these two. */
+#define _EQ_LOAD_ACQUIRE(p)     clib_load_acquire32(p)
+#define _EQ_STORE_RELEASE(p, v) clib_store_release32((p), (v))
+
+uint8_t edge_queue_init(EdgeEventQueue *q, EdgeEvent *storage, uint32_t capacity)
+{
+    if (!q || !storage) return 0u;
+    if (capacity < 2u || (capacity & (capacity - 1u)) != 0u) return 0u;
+
+    q->buffer = storage;
+    q->mask = capacity - 1u;
+    q->head = 0u;
+    q->tail = 0u;
+    q->dropped = 0u;
+    q->high_water = 0u;
+    return 1u;
+}
+
+uint8_t edge_queue_push(EdgeEventQueue *q, const EdgeEvent *ev)
+{
+    if (!q || !ev) return 0u;
+
+    uint32_t head = q->head;
+    uint32_t used = head - _EQ_LOAD_ACQUIRE(&q->tail);
+
+    if (used > q->mask) {
+        q->dropped++;
+        return 0u;
+    }
+
+    q->buffer[head & q->mask] = *ev;
+    _EQ_STORE_RELEASE(&q->head, head + 1u);
+
+    if (used + 1u > q->high_water)
+        q->high_water = used + 1u;
+    return 1u;
+}
+
+uint8_t edge_queue_pop(EdgeEventQueue *q, EdgeEvent *out)
+{
+    return (edge_queue_pop_batch(q, out, 1u) == 1u) ? 1u : 0u;
+}
+
+size_t edge_queue_pop_batch(EdgeEventQueue *q, EdgeEvent *out, size_t max)
+{
+    if (!q || !out) return 0u;
+
+    uint32_t tail = q->tail;
+    uint32_t avail = _EQ_LOAD_ACQUIRE(&q->head) - tail;
+    size_t n = (avail < max) ? avail : max;
+
+    for (size_t i = 0; i < n; i++) {
+        out[i] = q->buffer[(tail + (uint32_t)i) & q->mask];
+    }
+    _EQ_STORE_RELEASE(&q->tail, tail + (uint32_t)n);
+    return n;
+}
+
+uint32_t edge_queue_count(const EdgeEventQueue *q)
+{
+    if (!q) return 0u;
+
+    /* Tail first: head only grows past it, so the difference cannot wrap.
+     * A stale tail can still make it exceed the capacity. */
+    uint32_t tail = _EQ_LOAD_ACQUIRE(&q->tail);
+    uint32_t used = _EQ_LOAD_ACQUIRE(&q->head) - tail;
+    return (used > q->mask) ? q->mask + 1u : used;
+}
+
+uint32_t edge_queue_dropped(const EdgeEventQueue *q)
+{
+    if (!q) return 0u;
+    return q->dropped;
+}
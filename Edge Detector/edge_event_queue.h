@@ -0,0 +1,130 @@
+/**
+ * @file    edge_event_queue.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Lock-free single-producer/single-consumer edge event queue.
+ * @license MIT
+ *
+ * @details
+ * Lets `edge_update()` run inside an ISR while the actual event handling
+ * happens in a background task: the detector pushes a small record per
+ * edge and the task drains them in batches. Exactly one context may push
+ * (the producer, e.g. the ISR) and exactly one may pop (the consumer).
+ *
+ * Typical usage:
+ * @code
+ * static EdgeEvent storage[64];
+ * static EdgeEventQueue events;
+ * static EdgeDetector button;
+ * static EdgeHooks button_hooks;
+ *
+ * edge_queue_init(&events, storage, 64);
+ * edge_init(&button, 0);
+ * edge_attach_hooks(&button, &button_hooks);
+ * edge_attach_queue(&button, &events, BUTTON_ID);
+ *
+ * void EXTI0_IRQHandler(void) { edge_update_at(&button, read_pin(), TIM2->CNT); }
+ *
+ * void task(void) {
+ *     EdgeEvent batch[16];
+ *     size_t n = edge_queue_pop_batch(&events, batch, 16);
+ *     ...
+ * }
+ * @endcode
+ */
+
+#ifndef EDGE_EVENT_QUEUE_H
+#define EDGE_EVENT_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct EdgeEvent
+ * @brief One recorded edge.
+ */
+typedef struct {
+    uint32_t timestamp;     /**< Timestamp of the sample (see edge_update()). */
+    uint32_t signal_id;     /**< Id given in edge_attach_queue(). */
+    uint8_t type;           /**< EDGE_RISING or EDGE_FALLING (EdgeType). */
+} EdgeEvent;
+
+/**
+ * @struct EdgeEventQueue
+ * @brief Ring buffer over caller-provided storage.
+ *
+ * @var EdgeEventQueue::head
+ *      Free-running write index, written by the producer only.
+ * @var EdgeEventQueue::tail
+ *      Free-running read index, written by the consumer only.
+ * @var EdgeEventQueue::dropped
+ *      Events lost because the queue was full (producer side).
+ * @var EdgeEventQueue::high_water
+ *      Largest fill level observed by the producer.
+ */
+typedef struct EdgeEventQueue {
+    EdgeEvent *buffer;              /**< Storage, `capacity` entries. */
+    uint32_t mask;                  /**< capacity - 1 (capacity is a power of two). */
+    volatile uint32_t head;         /**< Producer index. */
+    volatile uint32_t tail;         /**< Consumer index. */
+    volatile uint32_t dropped;      /**< Overflow counter. */
+    volatile uint32_t high_water;   /**< Peak number of queued events. */
+} EdgeEventQueue;
+
+/**
+ * @brief Initializes an empty queue.
+ * @param q Pointer to the queue.
+ * @param storage Array of `capacity` events.
+ * @param capacity Number of entries; must be a power of two (>= 2).
+ * @return 1 on success, 0 on invalid arguments.
+ */
+uint8_t edge_queue_init(EdgeEventQueue *q, EdgeEvent *storage, uint32_t capacity);
+
+/**
+ * @brief Appends an event (producer only).
+ * @param q Pointer to the queue.
+ * @param ev Event to copy into the queue.
+ * @return 1 if stored, 0 if the queue was full (counted in `dropped`).
+ */
+uint8_t edge_queue_push(EdgeEventQueue *q, const EdgeEvent *ev);
+
+/**
+ * @brief Removes the oldest event (consumer only).
+ * @param q Pointer to the queue.
+ * @param out Destination for the event.
+ * @return 1 if an event was returned, 0 if the queue was empty.
+ */
+uint8_t edge_queue_pop(EdgeEventQueue *q, EdgeEvent *out);
+
+/**
+ * @brief Removes up to `max` events at once (consumer only).
+ * @param q Pointer to the queue.
+ * @param out Destination array.
+ * @param max Capacity of `out`.
+ * @return Number of events copied.
+ */
+size_t edge_queue_pop_batch(EdgeEventQueue *q, EdgeEvent *out, size_t max);
+
+/**
+ * @brief Number of queued events (approximate while the producer runs).
+ * @param q Pointer to the queue.
+ * @return 0..capacity, from either side or a third thread.
+ */
+uint32_t edge_queue_count(const EdgeEventQueue *q);
+
+/**
+ * @brief Number of events lost to overflow since init.
+ * @param q Pointer to the queue.
+ */
+uint32_t edge_queue_dropped(const EdgeEventQueue *q);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_EVENT_QUEUE_H */
@@ -0,0 +1,138 @@
+/**
+ * @file    edge_glitch.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the minimum-pulse-width glitch filter.
+ * @license MIT
+ *
+ * @details
+ * The packed path splits each word into runs of equal samples using the
+ * change mask `w ^ (w << 1 | prev)`: only the run lengths matter, so the
+ * cost is per change instead of per sample. Noisy words in which no run
+ * can reach `min_width` are rejected up front by eroding the continuation
+ * mask (log2(min_width) shift/AND steps), so glitch bursts cost about as
+ * much as quiet words. The run counter saturates at `min_width`, which
+ * keeps it from overflowing on long quiet streams.
+ */
+
+#include "edge_glitch.h"
+
+#include "../Common/bit_ops.h"
+
+void edge_glitch_init(EdgeGlitch *g, EdgeDetector *det, uint32_t min_width)
+{
+    if (!g) return;
+    g->det = det;
+    g->min_width = min_width ? min_width : 1u;
+    g->run = g->min_width;
+    g->changed_at = 0u;
+    g->level = det ? det->prev : 0u;
+}
+
+EdgeType edge_glitch_update(EdgeGlitch *g, uint8_t input)
+{
+    if (!g || !g->det) return EDGE_NONE;
+
+    input = input ? 1u : 0u;
+    if (input != g->level) {
+        g->level = input;
+        g->run = 1u;
+    }
+    else if (g->run < g->min_width) {
+        g->run++;
+    }
+
+    if (g->level != g->det->prev && g->run >= g->min_width)
+        return edge_update(g->det, g->level);
+    if (g->det->hooks) g->det->hooks->clock++; /* Filtered samples still take a tick */
+    return EDGE_NONE;
+}
+
+EdgeType edge_glitch_update_at(EdgeGlitch *g, uint8_t input, uint32_t now)
+{
+    if (!g || !g->det) return EDGE_NONE;
+
+    input = input ? 1u : 0u;
+    if (input != g->level) {
+        g->level = input;
+        g->changed_at = now;
+    }
+
+    if (g->level != g->det->prev && (uint32_t)(now - g->changed_at) >= g->min_width)
+        return edge_update_at(g->det, g->level, now);
+    if (g->det->hooks) g->det->hooks->clock = now + 1u;
+    return EDGE_NONE;
+}
+
+size_t edge_glitch_update_packed(EdgeGlitch *g, const uint8_t *bits, size_t nbits,
+                                 size_t *edge_indices, size_t max_indices)
+{
+    if (!g || !g->det || !bits) return 0u;
+
+    const uint32_t width = g->min_width;
+    const uint32_t base_ts = g->det->hooks ? g->det->hooks->clock : 0u;
+    uint32_t run = g->run;
+    uint8_t level = g->level;
+    size_t accepted = 0u;
+    size_t stored = 0u;
+
+    for (size_t base = 0; base < nbits; base += 64u) {
+        size_t left = nbits - base;
+        unsigned valid = (left >= 64u) ? 64u : (unsigned)left;
+        uint64_t w = bit_load_le64(bits + base / 8u, (valid + 7u) / 8u) & bit_mask64(valid);
+
+        /* Bit i set where a new run starts at sample i. */
+        uint64_t starts = (w ^ ((w << 1) | level)) & bit_mask64(valid);
+        unsigned pos = 0u;
+
+        if (starts && width > 1u && width <= 64u) {
+            /* Erode the continuation mask by width-1: bit i survives only
+             * if samples i-width+2..i continue one run (samples before the
+             * word count as continuing). Without survivors no run reaches
+             * width, so only the state of the last run needs updating. */
+            uint64_t reach = ~starts;
+            uint32_t covered = 1u;
+            while (covered < width - 1u) {
+                uint32_t s = (width - 1u - covered < covered) ? width - 1u - covered : covered;
+                reach &= (reach << s) | bit_mask64(s);
+                covered += s;
+            }
+            if (!(reach & bit_mask64(valid))) {
+                unsigned last = bit_msb64(starts);
+                run = valid - last;
+                level = (uint8_t)((w >> last) & 1u);
+                continue;
+            }
+        }
+
+        for (;;) {
+            unsigned end = starts ? bit_ctz64(starts) : valid;
+            if (end > pos) {
+                uint32_t before = run;
+                uint32_t seg = end - pos;
+                run = (width - run <= seg) ? width : run + seg;
+
+                if (level != g->det->prev && run >= width) {
+                    /* Confirmed at the sample where the run reached width */
+                    size_t at = base + pos + ((before < width) ? width - before - 1u : 0u);
+                    edge_update_at(g->det, level, base_ts + (uint32_t)at);
+                    if (edge_indices && stored < max_indices)
+                        edge_indices[stored++] = at;
+                    accepted++;
+                }
+            }
+            if (!starts) break;
+
+            starts &= starts - 1u;
+            pos = end;
+            level ^= 1u;
+            run = 0u;
+        }
+    }
+
+    g->run = run;
+    g->level = level;
+    if (g->det->hooks) g->det->hooks->clock = base_ts + (uint32_t)nbits;
+    return accepted;
+}
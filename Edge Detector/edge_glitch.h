@@ -0,0 +1,116 @@
+/**
+ * @file    edge_glitch.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Glitch filter in front of an EdgeDetector (minimum pulse width).
+ * @license MIT
+ *
+ * @details
+ * A new level reaches the attached EdgeDetector only after it has been
+ * present for `min_width` consecutive samples (or ticks with
+ * `edge_glitch_update_at()`). Shorter pulses of either polarity produce no
+ * edge at all, so they neither fire `on_edge` / the queue nor inflate the
+ * counters. Accepted edges are reported `min_width - 1` samples after the
+ * level change, at the sample that confirmed them; pulse widths measured by
+ * an attached EdgeTiming are unaffected since every edge is delayed equally.
+ *
+ * `min_width` = 1 passes every change through (same as `edge_update()`).
+ *
+ * Typical usage:
+ * @code
+ * EdgeDetector line;
+ * EdgeGlitch line_filter;
+ * edge_init(&line, 0);
+ * edge_glitch_init(&line_filter, &line, 4);   // reject pulses < 4 samples
+ * ...
+ * edge_glitch_update_packed(&line_filter, dma_buf, 8u * sizeof(dma_buf), 0, 0);
+ * @endcode
+ */
+
+#ifndef EDGE_GLITCH_H
+#define EDGE_GLITCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "edge_detector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct EdgeGlitch
+ * @brief Minimum-pulse-width filter state of one signal.
+ *
+ * @var EdgeGlitch::det
+ *      Detector receiving the accepted edges.
+ * @var EdgeGlitch::min_width
+ *      Shortest accepted pulse in samples (or ticks), at least 1.
+ * @var EdgeGlitch::run
+ *      Samples the raw level has been stable, saturated at min_width.
+ * @var EdgeGlitch::changed_at
+ *      Tick of the last raw change (`edge_glitch_update_at()` only).
+ * @var EdgeGlitch::level
+ *      Last raw sample.
+ */
+typedef struct {
+    EdgeDetector *det;
+    uint32_t min_width;
+    uint32_t run;
+    uint32_t changed_at;
+    uint8_t level;
+} EdgeGlitch;
+
+/**
+ * @brief Initializes a glitch filter in front of a detector.
+ * @param g Pointer to the EdgeGlitch instance.
+ * @param det Initialized detector; its current level is taken as stable.
+ * @param min_width Shortest accepted pulse (0 is treated as 1).
+ */
+void edge_glitch_init(EdgeGlitch *g, EdgeDetector *det, uint32_t min_width);
+
+/**
+ * @brief Processes one sample.
+ * @param g Pointer to the EdgeGlitch instance.
+ * @param input Current signal (0 or 1).
+ * @return Edge passed to the detector, or EDGE_NONE.
+ */
+EdgeType edge_glitch_update(EdgeGlitch *g, uint8_t input);
+
+/**
+ * @brief Processes one timestamped sample; `min_width` is in ticks.
+ * @param g Pointer to the EdgeGlitch instance.
+ * @param input Current signal (0 or 1).
+ * @param now Monotonic tick counter; wrap-around is handled.
+ * @return Edge passed to the detector (via `edge_update_at()`), or EDGE_NONE.
+ * @note Use either the sample or the tick based calls on one instance.
+ */
+EdgeType edge_glitch_update_at(EdgeGlitch *g, uint8_t input, uint32_t now);
+
+/**
+ * @brief Processes a packed bit stream (LSB-first, as `edge_update_packed()`).
+ * @param g Pointer to the EdgeGlitch instance.
+ * @param bits Packed samples.
+ * @param nbits Number of samples.
+ * @param edge_indices Optional output array for the confirming sample index
+ *        of every accepted edge (may be NULL).
+ * @param max_indices Capacity of `edge_indices`.
+ * @return Number of edges passed to the detector.
+ *
+ * @details
+ * Works a 64-bit word at a time and only visits level changes: a word
+ * without changes costs a few instructions, a noisy word one step per
+ * change. Accepted edges go through `edge_update_at()` stamped with the
+ * detector's sample clock (see `edge_update()`), so callbacks, queue and
+ * timing see them as usual; the clock advances by `nbits`.
+ */
+size_t edge_glitch_update_packed(EdgeGlitch *g, const uint8_t *bits, size_t nbits,
+                                 size_t *edge_indices, size_t max_indices);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_GLITCH_H */
@@ -0,0 +1,122 @@
+/**
+ * @file    edge_history.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the varint-encoded edge log.
+ * @license MIT
+ *
+ * @details
+ * Recording an edge is a subtraction and one to five byte stores. Once an
+ * edge has been dropped, later edges are dropped too (until the next
+ * `edge_history_clear()`), otherwise the implied alternation of levels
+ * would no longer hold for the stored records.
+ */
+
+#include "edge_history.h"
+
+/**
+ * @brief Encoded size of a gap in bytes.
+ */
+static inline uint32_t _edge_history_varint_len(uint32_t v)
+{
+    uint32_t len = 1u;
+    while (v >= 0x80u) {
+        v >>= 7;
+        len++;
+    }
+    return len;
+}
+
+void edge_history_init(EdgeHistory *h, uint8_t *buf, uint32_t capacity, uint32_t origin)
+{
+    if (!h) return;
+    h->buf = buf;
+    h->capacity = buf ? capacity : 0u;
+    h->used = 0u;
+    h->origin = origin;
+    h->last_ts = origin;
+    h->edges = 0u;
+    h->dropped = 0u;
+    h->first_level = 0u;
+    h->last_level = 0u;
+}
+
+uint8_t edge_history_record(EdgeHistory *h, uint8_t level, uint32_t timestamp)
+{
+    if (!h) return 0;
+
+    level = level ? 1u : 0u;
+    uint32_t gap = timestamp - h->last_ts;
+    uint32_t len = _edge_history_varint_len(gap);
+    h->last_ts = timestamp;
+    h->last_level = level;
+
+    if (h->dropped || h->capacity - h->used < len) {
+        h->dropped++;
+        return 0;
+    }
+
+    if (h->edges == 0u) h->first_level = level;
+    uint8_t *p = h->buf + h->used;
+    while (gap >= 0x80u) {
+        *p++ = (uint8_t)(gap | 0x80u);
+        gap >>= 7;
+    }
+    *p = (uint8_t)gap;
+    h->used += len;
+    h->edges++;
+    return 1;
+}
+
+void edge_history_clear(EdgeHistory *h)
+{
+    if (!h) return;
+    h->used = 0u;
+    h->edges = 0u;
+    h->dropped = 0u;
+    h->origin = h->last_ts;
+}
+
+void edge_history_iter_init(EdgeHistoryIter *it, const EdgeHistory *h)
+{
+    if (!it) return;
+    if (!h) {
+        edge_history_iter_init_raw(it, 0, 0u, 0u, 0u);
+        return;
+    }
+    edge_history_iter_init_raw(it, h->buf, h->used, h->origin, h->first_level);
+}
+
+void edge_history_iter_init_raw(EdgeHistoryIter *it, const uint8_t *data, size_t size,
+                                uint32_t origin, uint8_t first_level)
+{
+    if (!it) return;
+    it->data = data;
+    it->size = data ? size : 0u;
+    it->pos = 0u;
+    it->ts = origin;
+    it->level = first_level ? 1u : 0u;
+}
+
+uint8_t edge_history_next(EdgeHistoryIter *it, uint8_t *level, uint32_t *timestamp)
+{
+    if (!it) return 0;
+
+    uint32_t gap = 0u;
+    size_t pos = it->pos;
+    for (unsigned shift = 0u; shift < 7u * EDGE_HISTORY_MAX_RECORD; shift += 7u) {
+        if (pos >= it->size) return 0; /* End of log or truncated record */
+        uint8_t byte = it->data[pos++];
+        gap |= (uint32_t)(byte & 0x7Fu) << shift;
+        if (!(byte & 0x80u)) {
+            it->pos = pos;
+            it->ts += gap;
+            if (level) *level = it->level;
+            if (timestamp) *timestamp = it->ts;
+            it->level ^= 1u;
+            return 1;
+        }
+    }
+    return 0; /* Over-long record */
+}
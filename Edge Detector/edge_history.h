@@ -0,0 +1,181 @@
+/**
+ * @file    edge_history.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Compact delta/varint-encoded log of the edges of one signal.
+ * @license MIT
+ *
+ * @details
+ * An EdgeHistory attached to an EdgeDetector (`edge_attach_history()`)
+ * appends every edge to a caller-provided byte buffer. Edges of a binary
+ * signal alternate, so only the level of the first edge is kept; each edge
+ * is stored as the gap to the previous one (the first as the gap to
+ * `origin`), in LEB128 varint form: 7 bits per byte, high bit set on all
+ * but the last byte. Gaps below 128 ticks take one byte, below 16384 two,
+ * compared with a full EdgeEvent per edge in an EdgeEventQueue.
+ *
+ * Timestamps are those of the detector's samples: the ones given to the
+ * `_at` calls or the sample clock (see `edge_update()`), so edges from the
+ * buffer APIs log the same gaps as per-sample updates.
+ *
+ * Like edge_timing.h this header only depends on <stdint.h>, so the
+ * detector can include it; levels are passed as 1 (rising) / 0 (falling).
+ *
+ * When the buffer is full further edges are counted in `dropped` and not
+ * stored, so the stored part always decodes correctly. A typical logger
+ * writes the used bytes (`edge_history_bytes()`) to flash together with
+ * `origin` and `first_level` when the buffer runs low, then calls
+ * `edge_history_clear()`; the next segment continues from the last edge.
+ *
+ * Typical usage:
+ * @code
+ * static uint8_t log_buf[512];
+ * EdgeDetector line;
+ * EdgeHooks line_hooks;
+ * EdgeHistory line_log;
+ * edge_init(&line, 0);
+ * edge_attach_hooks(&line, &line_hooks);
+ * edge_history_init(&line_log, log_buf, sizeof(log_buf), now());
+ * edge_attach_history(&line, &line_log);
+ * ...
+ * edge_update_at(&line, read_pin(), now());
+ * ...
+ * EdgeHistoryIter it;
+ * uint8_t rising;
+ * uint32_t ts;
+ * edge_history_iter_init(&it, &line_log);
+ * while (edge_history_next(&it, &rising, &ts)) { ... }
+ * @endcode
+ */
+
+#ifndef EDGE_HISTORY_H
+#define EDGE_HISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Largest encoded size of one edge in bytes (32-bit gap). */
+#define EDGE_HISTORY_MAX_RECORD 5u
+
+/**
+ * @struct EdgeHistory
+ * @brief Append-only edge log over a caller-provided buffer.
+ *
+ * @var EdgeHistory::buf
+ *      Encoded gaps.
+ * @var EdgeHistory::capacity
+ *      Size of `buf` in bytes.
+ * @var EdgeHistory::used
+ *      Bytes of `buf` holding records.
+ * @var EdgeHistory::origin
+ *      Timestamp the first gap is measured from.
+ * @var EdgeHistory::last_ts
+ *      Timestamp of the last edge seen (stored or dropped).
+ * @var EdgeHistory::edges
+ *      Number of stored edges.
+ * @var EdgeHistory::dropped
+ *      Edges seen while the buffer was full.
+ * @var EdgeHistory::first_level
+ *      Level after the first stored edge (1 = rising).
+ * @var EdgeHistory::last_level
+ *      Level after the last edge seen.
+ */
+typedef struct EdgeHistory {
+    uint8_t *buf;
+    uint32_t capacity;
+    uint32_t used;
+    uint32_t origin;
+    uint32_t last_ts;
+    uint32_t edges;
+    uint32_t dropped;
+    uint8_t first_level;
+    uint8_t last_level;
+} EdgeHistory;
+
+/**
+ * @struct EdgeHistoryIter
+ * @brief Decoding position in an encoded log.
+ */
+typedef struct {
+    const uint8_t *data;    /**< Encoded gaps. */
+    size_t size;            /**< Bytes in `data`. */
+    size_t pos;             /**< Next byte to decode. */
+    uint32_t ts;            /**< Timestamp of the last decoded edge. */
+    uint8_t level;          /**< Level after the next edge. */
+} EdgeHistoryIter;
+
+/**
+ * @brief Initializes an empty log.
+ * @param h Pointer to the EdgeHistory instance.
+ * @param buf Storage for the records.
+ * @param capacity Size of `buf` in bytes.
+ * @param origin Timestamp the first gap is measured from.
+ */
+void edge_history_init(EdgeHistory *h, uint8_t *buf, uint32_t capacity, uint32_t origin);
+
+/**
+ * @brief Appends one edge (called by the detector for every edge).
+ * @param h Pointer to the EdgeHistory instance.
+ * @param level 1 for a rising edge, 0 for a falling edge.
+ * @param timestamp Time of the edge; wrap-around is handled as long as
+ *                  one gap fits in 32 bits.
+ * @return 1 if stored, 0 if dropped because the buffer is full.
+ */
+uint8_t edge_history_record(EdgeHistory *h, uint8_t level, uint32_t timestamp);
+
+/**
+ * @brief Starts a new segment after the last edge, keeping continuity.
+ * @param h Pointer to the EdgeHistory instance.
+ *
+ * @details
+ * Clears the records and the drop count; the new `origin` is the last
+ * edge seen, so gaps keep their meaning across segments.
+ */
+void edge_history_clear(EdgeHistory *h);
+
+/**
+ * @brief Number of encoded bytes.
+ * @param h Pointer to the EdgeHistory instance.
+ */
+static inline uint32_t edge_history_bytes(const EdgeHistory *h)
+{
+    return h ? h->used : 0u;
+}
+
+/**
+ * @brief Starts decoding a log.
+ * @param it Pointer to the iterator.
+ * @param h Log to decode (must not change while decoding).
+ */
+void edge_history_iter_init(EdgeHistoryIter *it, const EdgeHistory *h);
+
+/**
+ * @brief Starts decoding a stored segment.
+ * @param it Pointer to the iterator.
+ * @param data Encoded gaps (e.g. read back from flash).
+ * @param size Bytes in `data`.
+ * @param origin `EdgeHistory::origin` of the segment.
+ * @param first_level `EdgeHistory::first_level` of the segment.
+ */
+void edge_history_iter_init_raw(EdgeHistoryIter *it, const uint8_t *data, size_t size,
+                                uint32_t origin, uint8_t first_level);
+
+/**
+ * @brief Decodes the next edge.
+ * @param it Pointer to the iterator.
+ * @param level Receives 1 for a rising, 0 for a falling edge (may be NULL).
+ * @param timestamp Receives the time of the edge (may be NULL).
+ * @return 1 if an edge was decoded, 0 at the end or on a truncated record.
+ */
+uint8_t edge_history_next(EdgeHistoryIter *it, uint8_t *level, uint32_t *timestamp);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_HISTORY_H */
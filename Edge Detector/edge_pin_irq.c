@@ -0,0 +1,88 @@
+/**
+ * @file    edge_pin_irq.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the pin-change interrupt front end.
+ * @license MIT
+ *
+ * @details
+ * The ISR side only ORs the changed bits into the pending masks, so it is
+ * a handful of instructions regardless of how many pins changed. The task
+ * side copies and clears the masks inside a short critical section.
+ */
+
+#include "edge_pin_irq.h"
+
+#if !defined(EDGE_IRQ_LOCK)
+#  if defined(__GNUC__) && (defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_7M__) || \
+      defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_BASE__) || \
+      defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__))
+#    define EDGE_IRQ_LOCK(state) \
+         __asm volatile ("mrs %0, primask\n cpsid i" : "=r" (state) :: "memory")
+#    define EDGE_IRQ_UNLOCK(state) \
+         __asm volatile ("msr primask, %0" :: "r" (state) : "memory")
+#  else
+#    define EDGE_IRQ_LOCK(state)   ((void)(state))
+#    define EDGE_IRQ_UNLOCK(state) ((void)(state))
+#  endif
+#endif
+
+void edge_pin_irq_init(EdgePinIrq *irq, uint64_t initial_level)
+{
+    if (!irq) return;
+    irq->level = initial_level;
+    irq->rising = 0u;
+    irq->falling = 0u;
+    irq->first_ts = 0u;
+    irq->last_ts = 0u;
+    irq->irq_count = 0u;
+}
+
+uint64_t edge_pin_irq_capture(EdgePinIrq *irq, uint64_t snapshot, uint32_t timestamp)
+{
+    if (!irq) return 0u;
+
+    uint64_t changed = irq->level ^ snapshot;
+    if (!changed) return 0u;
+
+    if (irq->irq_count == 0u)
+        irq->first_ts = timestamp;
+    irq->rising |= changed & snapshot;
+    irq->falling |= changed & ~snapshot;
+    irq->level = snapshot;
+    irq->last_ts = timestamp;
+    irq->irq_count++;
+    return changed;
+}
+
+uint32_t edge_pin_irq_take(EdgePinIrq *irq, EdgePinBatch *batch)
+{
+    if (!irq || !batch) return 0u;
+
+    uint32_t state = 0u;
+    EDGE_IRQ_LOCK(state);
+    batch->rising = irq->rising;
+    batch->falling = irq->falling;
+    batch->level = irq->level;
+    batch->first_ts = irq->first_ts;
+    batch->last_ts = irq->last_ts;
+    batch->irq_count = irq->irq_count;
+    irq->rising = 0u;
+    irq->falling = 0u;
+    irq->irq_count = 0u;
+    EDGE_IRQ_UNLOCK(state);
+
+    return batch->irq_count;
+}
+
+uint32_t edge_pin_irq_service(EdgePinIrq *irq, EdgeArray *arr, uint32_t word, EdgePinBatch *batch)
+{
+    EdgePinBatch local;
+    if (!batch) batch = &local;
+
+    uint32_t count = edge_pin_irq_take(irq, batch);
+    if (count)
+        edge_array_apply_masks(arr, word, batch->rising, batch->falling, batch->level);
+    return count;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file    edge_pin_irq.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Event-driven edge detection from pin-change interrupts.
+ * @license MIT
+ *
+ * @details
+ * Replaces the polling loop: the pin-change ISR hands the port snapshot
+ * and a hardware timestamp to `edge_pin_irq_capture()`, which diffs it
+ * against the last snapshot and accumulates the changed bits. Interrupts
+ * that arrive before the task gets to run are coalesced into one pending
+ * batch; `edge_pin_irq_service()` then processes only the changed bits in
+ * one pass through an EdgeArray.
+ *
+ * Coalescing keeps at most one rising and one falling edge per pin per
+ * batch: a pin that toggles more than twice between two service passes is
+ * still counted once in each direction, and its final level is exact.
+ *
+ * Typical usage:
+ * @code
+ * static EdgePinIrq port_irq;
+ *
+ * void EXTI_IRQHandler(void) {
+ *     edge_pin_irq_capture(&port_irq, GPIOA->IDR, TIM2->CNT);
+ *     EXTI->PR = EXTI->PR;
+ * }
+ *
+ * void task(void) {
+ *     EdgePinBatch batch;
+ *     if (edge_pin_irq_service(&port_irq, &inputs, 0, &batch)) { ... }
+ * }
+ * @endcode
+ *
+ * The task side briefly masks interrupts while it takes the pending batch.
+ * Define `EDGE_IRQ_LOCK(state)` / `EDGE_IRQ_UNLOCK(state)` for targets other
+ * than Cortex-M (on hosted builds they default to no-ops, so the producer
+ * and consumer must then run in the same thread).
+ */
+
+#ifndef EDGE_PIN_IRQ_H
+#define EDGE_PIN_IRQ_H
+
+#include <stdint.h>
+
+#include "edge_array.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct EdgePinIrq
+ * @brief Port state shared between the pin-change ISR and the task.
+ *
+ * @var EdgePinIrq::level
+ *      Last port snapshot seen by the ISR.
+ * @var EdgePinIrq::rising
+ *      Pending rising edges (coalesced).
+ * @var EdgePinIrq::falling
+ *      Pending falling edges (coalesced).
+ * @var EdgePinIrq::first_ts
+ *      Timestamp of the first interrupt of the pending batch.
+ * @var EdgePinIrq::last_ts
+ *      Timestamp of the last interrupt of the pending batch.
+ * @var EdgePinIrq::irq_count
+ *      Interrupts coalesced into the pending batch.
+ */
+typedef struct {
+    volatile uint64_t level;
+    volatile uint64_t rising;
+    volatile uint64_t falling;
+    volatile uint32_t first_ts;
+    volatile uint32_t last_ts;
+    volatile uint32_t irq_count;
+} EdgePinIrq;
+
+/**
+ * @struct EdgePinBatch
+ * @brief One batch of coalesced pin changes, as taken by the task.
+ */
+typedef struct {
+    uint64_t rising;        /**< Pins with a rising edge. */
+    uint64_t falling;       /**< Pins with a falling edge. */
+    uint64_t level;         /**< Port level at the last interrupt. */
+    uint32_t first_ts;      /**< Timestamp of the first interrupt. */
+    uint32_t last_ts;       /**< Timestamp of the last interrupt. */
+    uint32_t irq_count;     /**< Number of coalesced interrupts. */
+} EdgePinBatch;
+
+/**
+ * @brief Initializes the shared state with the current port level.
+ * @param irq Pointer to the EdgePinIrq instance.
+ * @param initial_level Current port snapshot.
+ */
+void edge_pin_irq_init(EdgePinIrq *irq, uint64_t initial_level);
+
+/**
+ * @brief Records a port snapshot (call from the pin-change ISR).
+ * @param irq Pointer to the EdgePinIrq instance.
+ * @param snapshot Current port value.
+ * @param timestamp Hardware timestamp of the interrupt.
+ * @return Mask of pins that changed since the previous snapshot
+ *         (0 for a spurious interrupt, which is not counted).
+ */
+uint64_t edge_pin_irq_capture(EdgePinIrq *irq, uint64_t snapshot, uint32_t timestamp);
+
+/**
+ * @brief Takes the pending batch and clears it (call from the task).
+ * @param irq Pointer to the EdgePinIrq instance.
+ * @param batch Destination for the batch.
+ * @return Number of coalesced interrupts (0 if nothing was pending).
+ */
+uint32_t edge_pin_irq_take(EdgePinIrq *irq, EdgePinBatch *batch);
+
+/**
+ * @brief Takes the pending batch and applies it to 64 channels of an array.
+ * @param irq Pointer to the EdgePinIrq instance.
+ * @param arr EdgeArray receiving the edges (counters and callback).
+ * @param word Word index of the port within `arr`.
+ * @param batch Optional destination for the batch (may be NULL).
+ * @return Number of coalesced interrupts (0 if nothing was pending).
+ */
+uint32_t edge_pin_irq_service(EdgePinIrq *irq, EdgeArray *arr, uint32_t word, EdgePinBatch *batch);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_PIN_IRQ_H */
@@ -0,0 +1,209 @@
+/**
+ * @file    edge_rate.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the windowed edge statistics.
+ * @license MIT
+ *
+ * @details
+ * Counts only grow inside a window, so a channel outside the top-K table
+ * never has more edges than the table's smallest entry: it enters as soon
+ * as it exceeds that entry, replacing it. This keeps the table exact with
+ * K entries and no per-channel membership flag, and a channel whose old
+ * count is below the smallest entry is rejected without a scan.
+ */
+
+#include "edge_rate.h"
+#include "../Common/bit_ops.h"
+
+/**
+ * @brief Histogram bucket of a non-zero count.
+ */
+static inline uint32_t _edge_rate_bucket(uint32_t count)
+{
+    return 1u + bit_msb64(count);
+}
+
+/**
+ * @brief Brings a slot to the current window.
+ */
+static inline void _edge_rate_roll(const EdgeRate *r, EdgeRateSlot *s)
+{
+    if (s->epoch == r->epoch) return;
+    s->last = (s->epoch + 1u == r->epoch) ? s->current : 0u;
+    s->current = 0u;
+    s->epoch = r->epoch;
+}
+
+/**
+ * @brief Finds the smallest entry of the (full) top-K table.
+ */
+static void _edge_rate_find_min(EdgeRate *r)
+{
+    uint32_t min = 0u;
+    for (uint32_t i = 1; i < r->top_used; i++)
+        if (r->top[i].count < r->top[min].count) min = i;
+    r->top_min = min;
+}
+
+/**
+ * @brief Updates the top-K table after `channel` reached `count`.
+ */
+static void _edge_rate_top(EdgeRate *r, uint32_t channel, uint32_t count)
+{
+    uint32_t full = (r->top_used == r->top_capacity);
+
+    /* Below the smallest entry before this edge: not in the table, stays out */
+    if (full && count - 1u < r->top[r->top_min].count) return;
+
+    for (uint32_t i = 0; i < r->top_used; i++) {
+        if (r->top[i].channel == channel) {
+            r->top[i].count = count;
+            if (full && i == r->top_min) _edge_rate_find_min(r);
+            return;
+        }
+    }
+
+    if (!full) {
+        r->top[r->top_used].channel = channel;
+        r->top[r->top_used].count = count;
+        if (++r->top_used == r->top_capacity) _edge_rate_find_min(r);
+        return;
+    }
+
+    if (count > r->top[r->top_min].count) {
+        r->top[r->top_min].channel = channel;
+        r->top[r->top_min].count = count;
+        _edge_rate_find_min(r);
+    }
+}
+
+void edge_rate_init(EdgeRate *r, EdgeRateSlot *slots, uint32_t channels,
+                    EdgeRateTop *top, EdgeRateTop *last_top, uint32_t k,
+                    uint32_t window, uint32_t now)
+{
+    if (!r) return;
+    r->slots = slots;
+    r->channels = slots ? channels : 0u;
+    r->top = top;
+    r->last_top = last_top;
+    r->top_capacity = (top && last_top) ? k : 0u;
+    r->top_used = 0u;
+    r->last_top_used = 0u;
+    r->top_min = 0u;
+    r->window = window ? window : 1u;
+    r->window_start = now;
+    r->epoch = 0u;
+    for (uint32_t b = 0; b < EDGE_RATE_BUCKETS; b++) {
+        r->hist[b] = 0u;
+        r->last_hist[b] = 0u;
+    }
+    r->active = 0u;
+    r->last_active = 0u;
+    r->edges = 0u;
+    r->last_edges = 0u;
+    for (uint32_t c = 0; c < r->channels; c++) {
+        r->slots[c].epoch = 0u;
+        r->slots[c].current = 0u;
+        r->slots[c].last = 0u;
+    }
+}
+
+void edge_rate_record(EdgeRate *r, uint32_t channel)
+{
+    if (!r || channel >= r->channels) return;
+
+    EdgeRateSlot *s = &r->slots[channel];
+    _edge_rate_roll(r, s);
+    r->edges++;
+    if (s->current == UINT16_MAX) return; /* Saturated for this window */
+
+    uint32_t count = ++s->current;
+    if (count == 1u) r->active++;
+    if ((count & (count - 1u)) == 0u) {
+        /* Entered the next power-of-two bucket */
+        if (count > 1u) r->hist[_edge_rate_bucket(count - 1u)]--;
+        r->hist[_edge_rate_bucket(count)]++;
+    }
+    if (r->top_capacity) _edge_rate_top(r, channel, count);
+}
+
+uint32_t edge_rate_advance(EdgeRate *r, uint32_t now)
+{
+    if (!r) return 0u;
+
+    uint32_t elapsed = now - r->window_start;
+    if (elapsed < r->window) return 0u;
+    uint32_t closed = elapsed / r->window;
+    r->window_start += closed * r->window;
+
+    /* Snapshot the window that just ended (empty if several ended) */
+    uint32_t keep = (closed == 1u);
+    for (uint32_t b = 0; b < EDGE_RATE_BUCKETS; b++) {
+        r->last_hist[b] = keep ? r->hist[b] : 0u;
+        r->hist[b] = 0u;
+    }
+    r->last_active = keep ? r->active : 0u;
+    r->last_edges = keep ? r->edges : 0u;
+    r->last_top_used = keep ? r->top_used : 0u;
+
+    /* Sorted copy of the top-K table (K is small: insertion sort) */
+    for (uint32_t i = 0; i < r->last_top_used; i++) {
+        EdgeRateTop e = r->top[i];
+        uint32_t j = i;
+        while (j > 0u && (r->last_top[j - 1u].count < e.count ||
+                          (r->last_top[j - 1u].count == e.count && r->last_top[j - 1u].channel > e.channel))) {
+            r->last_top[j] = r->last_top[j - 1u];
+            j--;
+        }
+        r->last_top[j] = e;
+    }
+
+    r->active = 0u;
+    r->edges = 0u;
+    r->top_used = 0u;
+    r->top_min = 0u;
+    r->epoch += closed;
+    return closed;
+}
+
+uint32_t edge_rate_last(const EdgeRate *r, uint32_t channel)
+{
+    if (!r || channel >= r->channels) return 0u;
+    const EdgeRateSlot *s = &r->slots[channel];
+    if (s->epoch == r->epoch) return s->last;
+    if (s->epoch + 1u == r->epoch) return s->current;
+    return 0u;
+}
+
+uint32_t edge_rate_current(const EdgeRate *r, uint32_t channel)
+{
+    if (!r || channel >= r->channels) return 0u;
+    const EdgeRateSlot *s = &r->slots[channel];
+    return (s->epoch == r->epoch) ? s->current : 0u;
+}
+
+uint64_t edge_rate_per_second_milli(const EdgeRate *r, uint32_t channel, uint32_t tick_hz)
+{
+    if (!r) return 0u;
+    return (uint64_t)edge_rate_last(r, channel) * tick_hz * 1000u / r->window;
+}
+
+uint32_t edge_rate_histogram(const EdgeRate *r, uint32_t *out)
+{
+    if (!r || !out) return 0u;
+    out[0] = r->channels - r->last_active;
+    for (uint32_t b = 1; b < EDGE_RATE_BUCKETS; b++)
+        out[b] = r->last_hist[b];
+    return r->last_active;
+}
+
+uint32_t edge_rate_top(const EdgeRate *r, EdgeRateTop *out, uint32_t max)
+{
+    if (!r || !out) return 0u;
+    uint32_t n = (r->last_top_used < max) ? r->last_top_used : max;
+    for (uint32_t i = 0; i < n; i++)
+        out[i] = r->last_top[i];
+    return n;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file    edge_rate.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Windowed edge rates, rate histogram and top-K channels of a bank.
+ * @license MIT
+ *
+ * @details
+ * An EdgeRate attached to an EdgeArray (`edge_array_attach_rate()`) counts
+ * the edges of every channel in fixed windows of `window` ticks while the
+ * array is updated, and keeps for the current and the last completed
+ * window:
+ * - the edge count of each channel (saturating at 65535 per window),
+ * - a histogram of the per-channel counts in power-of-two buckets
+ *   (bucket 0: no edge, bucket b: 2^(b-1) .. 2^b - 1 edges),
+ * - the K most active channels, exact, with their counts.
+ *
+ * Each edge costs a few instructions; channels above the smallest top-K
+ * count additionally scan the K entries. Windows are closed by
+ * `edge_rate_advance()`, which costs O(K + buckets) and never touches the
+ * per-channel slots: a slot is rolled over lazily at its next edge or
+ * read. Dashboards read the last window instead of differencing the
+ * cumulative counters of every channel.
+ *
+ * Like edge_timing.h this header only depends on <stdint.h>, so the array
+ * can include it.
+ *
+ * Typical usage:
+ * @code
+ * static EdgeRateSlot slots[CHANNELS];
+ * static EdgeRateTop top[8], last_top[8];
+ * static EdgeRate rate;
+ * edge_rate_init(&rate, slots, CHANNELS, top, last_top, 8, 1000, millis());
+ * edge_array_attach_rate(&inputs, &rate);
+ * ...
+ * if (edge_rate_advance(&rate, millis())) {       // one window per second
+ *     EdgeRateTop hot[8];
+ *     uint32_t n = edge_rate_top(&rate, hot, 8);
+ *     ...
+ * }
+ * @endcode
+ */
+
+#ifndef EDGE_RATE_H
+#define EDGE_RATE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Histogram buckets: no edge, then one per power of two up to 65535. */
+#define EDGE_RATE_BUCKETS 17u
+
+/**
+ * @struct EdgeRateSlot
+ * @brief Per-channel window counters (8 bytes, zero-initialized is valid).
+ */
+typedef struct {
+    uint32_t epoch;     /**< Window `current` belongs to. */
+    uint16_t current;   /**< Edges in window `epoch`. */
+    uint16_t last;      /**< Edges in window `epoch - 1`. */
+} EdgeRateSlot;
+
+/**
+ * @struct EdgeRateTop
+ * @brief One entry of a top-K table.
+ */
+typedef struct {
+    uint32_t channel;   /**< Channel number. */
+    uint32_t count;     /**< Edges in the window. */
+} EdgeRateTop;
+
+/**
+ * @struct EdgeRate
+ * @brief Windowed statistics of one channel bank.
+ *
+ * @var EdgeRate::slots
+ *      Per-channel counters, `channels` entries.
+ * @var EdgeRate::top
+ *      Top-K table of the current window (unordered), `top_capacity` entries.
+ * @var EdgeRate::last_top
+ *      Top-K table of the last window, sorted by count (descending).
+ * @var EdgeRate::epoch
+ *      Number of the current window.
+ * @var EdgeRate::window_start
+ *      Tick at which the current window started.
+ * @var EdgeRate::hist
+ *      Current window histogram of the active channels (bucket 0 unused).
+ * @var EdgeRate::last_hist
+ *      Last window histogram (bucket 0 unused, see `edge_rate_histogram()`).
+ * @var EdgeRate::active
+ *      Channels with at least one edge in the current window.
+ * @var EdgeRate::edges
+ *      Edges in the current window.
+ */
+typedef struct EdgeRate {
+    EdgeRateSlot *slots;
+    EdgeRateTop *top;
+    EdgeRateTop *last_top;
+    uint32_t channels;
+    uint32_t window;
+    uint32_t window_start;
+    uint32_t epoch;
+    uint32_t top_capacity;
+    uint32_t top_used;
+    uint32_t last_top_used;
+    uint32_t top_min;           /**< Index of the smallest entry of a full `top`. */
+    uint32_t hist[EDGE_RATE_BUCKETS];
+    uint32_t last_hist[EDGE_RATE_BUCKETS];
+    uint32_t active;
+    uint32_t last_active;
+    uint64_t edges;
+    uint64_t last_edges;
+} EdgeRate;
+
+/**
+ * @brief Initializes the statistics over caller-provided storage.
+ * @param r Pointer to the EdgeRate instance.
+ * @param slots Array of `channels` slots (cleared here).
+ * @param channels Number of channels of the bank.
+ * @param top Array of `k` entries for the current window (may be NULL if k = 0).
+ * @param last_top Array of `k` entries for the last window.
+ * @param k Size of the top-K tables.
+ * @param window Window length in ticks (at least 1).
+ * @param now Current tick, start of the first window.
+ */
+void edge_rate_init(EdgeRate *r, EdgeRateSlot *slots, uint32_t channels,
+                    EdgeRateTop *top, EdgeRateTop *last_top, uint32_t k,
+                    uint32_t window, uint32_t now);
+
+/**
+ * @brief Counts one edge (called by the array for every edge).
+ * @param r Pointer to the EdgeRate instance.
+ * @param channel Channel of the edge.
+ */
+void edge_rate_record(EdgeRate *r, uint32_t channel);
+
+/**
+ * @brief Closes the windows that ended before `now`.
+ * @param r Pointer to the EdgeRate instance.
+ * @param now Current tick; wrap-around is handled.
+ * @return Number of windows closed (0 if the current window is still open).
+ *
+ * @details
+ * If more than one window ended, the last one had no edges and is reported
+ * as empty.
+ */
+uint32_t edge_rate_advance(EdgeRate *r, uint32_t now);
+
+/**
+ * @brief Edges of a channel in the last completed window.
+ * @param r Pointer to the EdgeRate instance.
+ * @param channel Channel number.
+ */
+uint32_t edge_rate_last(const EdgeRate *r, uint32_t channel);
+
+/**
+ * @brief Edges of a channel so far in the current window.
+ * @param r Pointer to the EdgeRate instance.
+ * @param channel Channel number.
+ */
+uint32_t edge_rate_current(const EdgeRate *r, uint32_t channel);
+
+/**
+ * @brief Edge rate of a channel over the last window.
+ * @param r Pointer to the EdgeRate instance.
+ * @param channel Channel number.
+ * @param tick_hz Tick frequency in Hz.
+ * @return Edges per second * 1000.
+ */
+uint64_t edge_rate_per_second_milli(const EdgeRate *r, uint32_t channel, uint32_t tick_hz);
+
+/**
+ * @brief Histogram of the per-channel counts of the last window.
+ * @param r Pointer to the EdgeRate instance.
+ * @param out EDGE_RATE_BUCKETS entries; out[0] = channels without edges,
+ *            out[b] = channels with 2^(b-1) .. 2^b - 1 edges.
+ * @return Number of channels with at least one edge.
+ */
+uint32_t edge_rate_histogram(const EdgeRate *r, uint32_t *out);
+
+/**
+ * @brief Most active channels of the last window.
+ * @param r Pointer to the EdgeRate instance.
+ * @param out Receives up to `max` entries, highest count first (ties: lower channel first).
+ * @param max Capacity of `out`.
+ * @return Number of entries written.
+ */
+uint32_t edge_rate_top(const EdgeRate *r, EdgeRateTop *out, uint32_t max);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_RATE_H */
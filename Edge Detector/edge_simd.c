@@ -0,0 +1,184 @@
+/**
+ * @file    edge_simd.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   SIMD transition counting kernels (AVX2 / SSE2 / NEON / scalar).
+ * @license MIT
+ *
+ * @details
+ * The x86 kernels turn 64 samples into a 64-bit "sample is zero" mask
+ * (compare + movemask) and count the bits that differ from their
+ * predecessor with one popcount. The NEON kernel compares each vector with
+ * itself shifted by one lane. Every kernel handles whole 64-byte blocks and
+ * leaves the tail to the scalar loop, so results never depend on the
+ * selected instruction set.
+ */
+
+#include "edge_simd.h"
+#include "../Common/bit_ops.h"
+
+#if !defined(EDGE_SIMD_DISABLE)
+#  if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#    define EDGE_SIMD_SSE2 1
+#    include <emmintrin.h>
+#    if defined(__AVX2__)
+#      undef  EDGE_SIMD_SSE2
+#      define EDGE_SIMD_AVX2 1
+#      define EDGE_SIMD_AVX2_TARGET
+#      include <immintrin.h>
+#    elif (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#      define EDGE_SIMD_AVX2 1
+#      define EDGE_SIMD_AVX2_DISPATCH 1
+#      define EDGE_SIMD_AVX2_TARGET __attribute__((target("avx2,popcnt")))
+#      include <immintrin.h>
+#    endif
+#  elif defined(__aarch64__) && defined(__ARM_NEON)
+#    define EDGE_SIMD_NEON 1
+#    include <arm_neon.h>
+#  endif
+#endif
+
+/** Samples consumed per iteration of the vector kernels. */
+#define EDGE_SIMD_BLOCK 64u
+
+size_t edge_simd_count_transitions_scalar(uint8_t prev, const uint8_t *samples, size_t n)
+{
+    size_t transitions = 0u;
+    prev = (prev != 0u);
+    for (size_t i = 0; i < n; i++) {
+        uint8_t current = (samples[i] != 0u);
+        transitions += (size_t)(current ^ prev);
+        prev = current;
+    }
+    return transitions;
+}
+
+#if defined(EDGE_SIMD_SSE2)
+static size_t _edge_kernel_sse2(uint8_t prev, const uint8_t *samples, size_t blocks)
+{
+    const __m128i zero = _mm_setzero_si128();
+    uint64_t carry = prev ? 0u : 1u; /* "previous sample is zero" flag */
+    size_t transitions = 0u;
+
+    for (size_t b = 0; b < blocks; b++) {
+        const uint8_t *p = samples + b * EDGE_SIMD_BLOCK;
+        uint64_t m0 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p +  0)), zero));
+        uint64_t m1 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + 16)), zero));
+        uint64_t m2 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + 32)), zero));
+        uint64_t m3 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + 48)), zero));
+        uint64_t m = m0 | (m1 << 16) | (m2 << 32) | (m3 << 48);
+
+        transitions += bit_popcount64(m ^ ((m << 1) | carry));
+        carry = m >> 63;
+    }
+    return transitions;
+}
+#endif
+
+#if defined(EDGE_SIMD_AVX2)
+EDGE_SIMD_AVX2_TARGET
+static size_t _edge_kernel_avx2(uint8_t prev, const uint8_t *samples, size_t blocks)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    uint64_t carry = prev ? 0u : 1u;
+    size_t transitions = 0u;
+
+    for (size_t b = 0; b < blocks; b++) {
+        const uint8_t *p = samples + b * EDGE_SIMD_BLOCK;
+        uint64_t lo = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p +  0)), zero));
+        uint64_t hi = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p + 32)), zero));
+        uint64_t m = lo | (hi << 32);
+
+        transitions += (size_t)__builtin_popcountll(m ^ ((m << 1) | carry));
+        carry = m >> 63;
+    }
+    return transitions;
+}
+#endif
+
+#if defined(EDGE_SIMD_NEON)
+static size_t _edge_kernel_neon(uint8_t prev, const uint8_t *samples, size_t blocks)
+{
+    const uint8x16_t zero = vdupq_n_u8(0u);
+    /* Only lane 15 of the previous vector is consumed by vextq_u8(). */
+    uint8x16_t zprev = vdupq_n_u8(prev ? 0x00u : 0xFFu);
+    size_t transitions = 0u;
+
+    for (size_t b = 0; b < blocks * (EDGE_SIMD_BLOCK / 16u); b++) {
+        uint8x16_t z = vceqq_u8(vld1q_u8(samples + b * 16u), zero);
+        uint8x16_t d = veorq_u8(z, vextq_u8(zprev, z, 15));
+        transitions += vaddvq_u8(vshrq_n_u8(d, 7));
+        zprev = z;
+    }
+    return transitions;
+}
+#endif
+
+typedef size_t (*_edge_kernel_fn)(uint8_t prev, const uint8_t *samples, size_t blocks);
+
+static _edge_kernel_fn _edge_select_kernel(void)
+{
+#if defined(EDGE_SIMD_AVX2_DISPATCH)
+    /* libgcc's constructor has run: no __builtin_cpu_init() needed */
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+        return _edge_kernel_avx2;
+    return _edge_kernel_sse2;
+#elif defined(EDGE_SIMD_AVX2)
+    return _edge_kernel_avx2;
+#elif defined(EDGE_SIMD_SSE2)
+    return _edge_kernel_sse2;
+#elif defined(EDGE_SIMD_NEON)
+    return _edge_kernel_neon;
+#else
+    return 0;
+#endif
+}
+
+static _edge_kernel_fn _edge_kernel(void)
+{
+#if defined(EDGE_SIMD_AVX2_DISPATCH)
+    /* Resolved at the first call. Threads may race here (shard engine):
+     * relaxed atomics make that well defined, and all store the same value. */
+    static _edge_kernel_fn kernel;
+    _edge_kernel_fn k = __atomic_load_n(&kernel, __ATOMIC_RELAXED);
+    if (!k) {
+        k = _edge_select_kernel();
+        __atomic_store_n(&kernel, k, __ATOMIC_RELAXED);
+    }
+    return k;
+#else
+    return _edge_select_kernel(); /* Fixed at build time */
+#endif
+}
+
+size_t edge_simd_count_transitions(uint8_t prev, const uint8_t *samples, size_t n)
+{
+    prev = (prev != 0u);
+    _edge_kernel_fn kernel = _edge_kernel();
+    size_t blocks = kernel ? n / EDGE_SIMD_BLOCK : 0u;
+    size_t done = blocks * EDGE_SIMD_BLOCK;
+    size_t transitions = 0u;
+
+    if (blocks) {
+        transitions = kernel(prev, samples, blocks);
+        prev = (samples[done - 1u] != 0u);
+    }
+    return transitions + edge_simd_count_transitions_scalar(prev, samples + done, n - done);
+}
+
+const char *edge_simd_kernel_name(void)
+{
+    _edge_kernel_fn kernel = _edge_kernel();
+    (void)kernel;
+#if defined(EDGE_SIMD_AVX2)
+    if (kernel == _edge_kernel_avx2) return "avx2";
+#endif
+#if defined(EDGE_SIMD_SSE2)
+    if (kernel == _edge_kernel_sse2) return "sse2";
+#endif
+#if defined(EDGE_SIMD_NEON)
+    if (kernel == _edge_kernel_neon) return "neon";
+#endif
+    return "scalar";
+}
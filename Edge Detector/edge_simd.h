@@ -0,0 +1,58 @@
+/**
+ * @file    edge_simd.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Vectorized transition counting kernels used by the buffer API.
+ * @license MIT
+ *
+ * @details
+ * Internal header of the edge detector: the kernels count how many
+ * consecutive samples differ after 0/1 normalization. Because rising and
+ * falling edges of a binary signal alternate, the split into rising and
+ * falling counts follows from this total and the starting level.
+ *
+ * Implementations (selected automatically):
+ * - AVX2  : x86, runtime-dispatched on GCC/Clang, or forced with -mavx2.
+ * - SSE2  : x86-64 baseline.
+ * - NEON  : AArch64.
+ * - Scalar: everything else, or when EDGE_SIMD_DISABLE is defined.
+ *
+ * All implementations return bit-identical results.
+ */
+
+#ifndef EDGE_SIMD_H
+#define EDGE_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Counts level changes in a byte-per-sample buffer.
+ * @param prev Normalized level before the first sample (0 or 1).
+ * @param samples Buffer of signal values (0 or non-zero).
+ * @param n Number of samples.
+ * @return Number of i for which norm01(samples[i]) != norm01(samples[i-1]),
+ *         with samples[-1] taken as `prev`.
+ */
+size_t edge_simd_count_transitions(uint8_t prev, const uint8_t *samples, size_t n);
+
+/**
+ * @brief Scalar reference of edge_simd_count_transitions().
+ */
+size_t edge_simd_count_transitions_scalar(uint8_t prev, const uint8_t *samples, size_t n);
+
+/**
+ * @brief Name of the kernel selected at build/run time ("avx2", "sse2", "neon", "scalar").
+ */
+const char *edge_simd_kernel_name(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_SIMD_H */
@@ -0,0 +1,435 @@
+/**
+ * @file    edge_stream.hpp
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   C++20 coroutine interface delivering EdgeArray edges in batches.
+ * @license MIT
+ *
+ * @details
+ * `clib::EdgeStream` feeds an EdgeArray with the bulk row API (time-major
+ * rows of `EDGE_ARRAY_WORDS(channels)` words, as in shard_engine.h) and
+ * routes every edge to the `clib::EdgeSubscriber` owning its channel. A
+ * consumer coroutine `co_await`s `next()` and sleeps, with no thread and
+ * no polling, until its ring holds `batch` events; the stream is flushed
+ * (`flush()`) to hand out partial batches, and `close()` ends all streams.
+ *
+ * Memory is fixed and caller-provided: one ring per subscriber and one
+ * route pointer per channel. Nothing is dropped. A row is only processed
+ * while every subscriber has room for an edge on each of its channels;
+ * otherwise `update_rows()` stops early (backpressure on a plain producer)
+ * and a producer coroutine can `co_await writable()`, which runs the
+ * blocked consumers until there is room again.
+ *
+ * @code
+ * clib::EdgeTask consume(clib::EdgeSubscriber &sub)
+ * {
+ *     for (;;) {
+ *         auto batch = co_await sub.next();
+ *         if (batch.empty()) co_return;              // stream closed
+ *         for (const clib::EdgeStreamEvent &e : batch) handle(e);
+ *     }
+ * }
+ *
+ * clib::EdgeTask produce(clib::EdgeStream &stream)
+ * {
+ *     while (read_block(rows, &n))
+ *         for (size_t done = 0; done < n; done += stream.update_rows(rows + done * words, n - done))
+ *             co_await stream.writable();
+ *     stream.close();
+ * }
+ * @endcode
+ *
+ * Single-threaded: the stream, its subscribers and all the coroutines
+ * awaiting them belong to one thread (one event loop). A consumer runs
+ * inside the `update_rows()`, `flush()` or `close()` call that woke it and
+ * must not call them itself nor unsubscribe other subscribers. Edges are
+ * delivered to each subscriber in row order, then in channel order.
+ */
+
+#ifndef EDGE_STREAM_HPP
+#define EDGE_STREAM_HPP
+
+#if __cplusplus < 202002L || !defined(__cpp_impl_coroutine)
+#error "edge_stream.hpp needs C++20 coroutines"
+#endif
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <span>
+#include <utility>
+
+#include "edge_array.h"
+
+namespace clib {
+
+/** @brief One edge as delivered to a subscriber. */
+struct EdgeStreamEvent {
+    std::uint64_t step;         /**< Row index since the stream was created. */
+    std::uint32_t channel;      /**< EdgeArray channel. */
+    EdgeType type;              /**< EDGE_RISING or EDGE_FALLING. */
+};
+
+/**
+ * @brief Minimal fire-and-forget coroutine type for producers and consumers.
+ *
+ * Starts running immediately and frees its frame when it returns; the
+ * frame is allocated once per coroutine, not per batch.
+ */
+struct EdgeTask {
+    struct promise_type {
+        EdgeTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+class EdgeStream;
+
+/**
+ * @brief Consumer end: edges of a contiguous channel range.
+ *
+ * Must outlive its subscription (the destructor unsubscribes).
+ */
+class EdgeSubscriber {
+public:
+    class NextBatch;
+
+    /**
+     * @brief Creates an unsubscribed consumer.
+     * @param storage Event ring; needs at least one slot per subscribed channel.
+     * @param batch Events that wake the consumer (at least 1).
+     */
+    explicit EdgeSubscriber(std::span<EdgeStreamEvent> storage, std::size_t batch = 1u) noexcept
+        : buf_(storage.data()), cap_(storage.size()), batch_(batch ? batch : 1u) {}
+
+    EdgeSubscriber(const EdgeSubscriber &) = delete;
+    EdgeSubscriber &operator=(const EdgeSubscriber &) = delete;
+    inline ~EdgeSubscriber();
+
+    /**
+     * @brief Awaits the next batch.
+     * @return Awaitable yielding `std::span<const EdgeStreamEvent>`: the
+     *         pending events in order (at least `batch` unless flushed,
+     *         closed or the ring is full), valid until the following
+     *         `next()`. Events that wrap around the end of the ring come as
+     *         two spans; the second is returned by the following `next()`
+     *         without suspending. Empty once the stream is closed and
+     *         drained, or when not subscribed.
+     */
+    inline NextBatch next() noexcept;
+
+    /** @brief Events received and not yet handed out. */
+    std::size_t pending() const noexcept { return count_ - taken_; }
+    /** @brief First subscribed channel. */
+    std::uint32_t first_channel() const noexcept { return first_; }
+    /** @brief Number of subscribed channels (0 when not subscribed). */
+    std::uint32_t channels() const noexcept { return width_; }
+
+private:
+    friend class EdgeStream;
+
+    std::size_t free_slots() const noexcept { return cap_ - count_; }
+
+    EdgeStreamEvent *buf_;
+    std::size_t cap_;
+    std::size_t batch_;
+    std::size_t head_ = 0u;         // Next slot written
+    std::size_t tail_ = 0u;         // Oldest event
+    std::size_t count_ = 0u;        // Events in the ring, handed out or not
+    std::size_t taken_ = 0u;        // Events of the batch being handled
+    std::uint32_t first_ = 0u;
+    std::uint32_t width_ = 0u;
+    EdgeStream *stream_ = nullptr;
+    std::coroutine_handle<> waiter_;
+    EdgeSubscriber *next_touched_ = nullptr;
+    bool touched_ = false;          // Linked in the stream's wake list
+    bool blocked_ = false;          // Fewer free slots than channels
+    bool split_ = false;            // Last span stopped at the ring end
+};
+
+/**
+ * @brief Producer end bound to one EdgeArray.
+ */
+class EdgeStream {
+public:
+    class Writable;
+
+    /**
+     * @brief Binds a stream to an initialized EdgeArray.
+     * @param arr Channel bank; its callback is taken over by the stream.
+     * @param routes One entry per channel (`arr.channels`), owned by the stream.
+     */
+    EdgeStream(::EdgeArray &arr, std::span<EdgeSubscriber *> routes) noexcept
+        : arr_(&arr), routes_(routes.data()),
+          channels_(routes.size() < arr.channels ? static_cast<std::uint32_t>(routes.size()) : arr.channels)
+    {
+        for (EdgeSubscriber *&r : routes) r = nullptr;
+        edge_array_set_callback(arr_, &EdgeStream::on_edge_, this);
+    }
+
+    EdgeStream(const EdgeStream &) = delete;
+    EdgeStream &operator=(const EdgeStream &) = delete;
+
+    ~EdgeStream()
+    {
+        for (std::uint32_t ch = 0; ch < channels_;) {
+            EdgeSubscriber *s = routes_[ch];
+            if (!s) { ch++; continue; }
+            ch = s->first_ + s->width_;
+            unsubscribe(*s);
+        }
+        edge_array_set_callback(arr_, nullptr, nullptr);
+    }
+
+    /**
+     * @brief Routes channels [first, first + count) to a subscriber.
+     * @return false if the range is invalid or taken, the subscriber is
+     *         already subscribed, or its ring is smaller than `count`.
+     */
+    bool subscribe(EdgeSubscriber &s, std::uint32_t first, std::uint32_t count) noexcept
+    {
+        if (s.stream_ || count == 0u || first >= channels_ || count > channels_ - first) return false;
+        if (s.cap_ < count) return false;
+        for (std::uint32_t ch = first; ch < first + count; ch++)
+            if (routes_[ch]) return false;
+        for (std::uint32_t ch = first; ch < first + count; ch++) routes_[ch] = &s;
+        s.stream_ = this;
+        s.first_ = first;
+        s.width_ = count;
+        s.head_ = s.tail_ = s.count_ = s.taken_ = 0u;
+        s.blocked_ = false;
+        s.split_ = false;
+        return true;
+    }
+
+    /**
+     * @brief Removes a subscriber; pending events are discarded and a
+     *        waiting consumer stays suspended.
+     */
+    void unsubscribe(EdgeSubscriber &s) noexcept
+    {
+        if (s.stream_ != this) return;
+        for (std::uint32_t ch = s.first_; ch < s.first_ + s.width_; ch++) routes_[ch] = nullptr;
+        if (s.blocked_) blocked_--;
+        if (s.touched_) {
+            EdgeSubscriber **link = &touched_;
+            while (*link != &s) link = &(*link)->next_touched_;
+            *link = s.next_touched_;
+            s.touched_ = false;
+        }
+        s.stream_ = nullptr;
+        s.width_ = 0u;
+        s.blocked_ = false;
+        s.split_ = false;
+        s.count_ = s.taken_ = 0u;
+    }
+
+    /**
+     * @brief Feeds rows of samples and wakes the consumers with full batches.
+     * @param rows `n` rows of `EDGE_ARRAY_WORDS(channels)` words, oldest first.
+     * @param n Number of rows.
+     * @return Rows processed; fewer than `n` when a subscriber ran out of
+     *         room (see `writable()`), 0 once closed.
+     */
+    std::size_t update_rows(const std::uint64_t *rows, std::size_t n) noexcept
+    {
+        const std::uint32_t words = EDGE_ARRAY_WORDS(arr_->channels);
+        std::size_t done = 0u;
+        while (done < n && blocked_ == 0u && !closed_) {
+            const std::uint64_t *row = rows + done * words;
+            for (std::uint32_t w = 0; w < words; w++) edge_array_update_word(arr_, w, row[w]);
+            step_++;
+            done++;
+        }
+        wake_(false);
+        return done;
+    }
+
+    /** @brief True if the next row can be processed. */
+    bool accepting() const noexcept { return blocked_ == 0u; }
+
+    /**
+     * @brief Awaitable for a producer coroutine: resumes once `accepting()`
+     *        (or the stream is closed), running blocked consumers meanwhile.
+     */
+    inline Writable writable() noexcept;
+
+    /** @brief Wakes every waiting consumer that has at least one event. */
+    void flush() noexcept { wake_(true); }
+
+    /** @brief Ends the stream: waiting consumers get their last events, then an empty batch. */
+    void close() noexcept
+    {
+        closed_ = true;
+        for (std::uint32_t ch = 0; ch < channels_;) {
+            EdgeSubscriber *s = routes_[ch];
+            if (!s) { ch++; continue; }
+            ch = s->first_ + s->width_;
+            if (s->waiter_) std::exchange(s->waiter_, nullptr).resume();
+        }
+    }
+
+    /** @brief True after `close()`. */
+    bool closed() const noexcept { return closed_; }
+
+    /** @brief Rows processed so far (step of the next row). */
+    std::uint64_t step() const noexcept { return step_; }
+
+private:
+    friend class EdgeSubscriber;
+
+    static void on_edge_(void *ctx, EdgeType type, std::uint32_t channel)
+    {
+        EdgeStream *self = static_cast<EdgeStream *>(ctx);
+        if (channel < self->channels_ && self->routes_[channel])
+            self->push_(*self->routes_[channel], channel, type);
+    }
+
+    void push_(EdgeSubscriber &s, std::uint32_t channel, EdgeType type) noexcept
+    {
+        // Cannot overflow: a row only starts while every ring has `width_` free slots
+        s.buf_[s.head_] = EdgeStreamEvent{ step_, channel, type };
+        s.head_ = (s.head_ + 1u == s.cap_) ? 0u : s.head_ + 1u;
+        s.count_++;
+        if (!s.blocked_ && s.free_slots() < s.width_) {
+            s.blocked_ = true;
+            blocked_++;
+        }
+        touch_(s);
+    }
+
+    // Frees the batch the consumer has finished with.
+    void release_(EdgeSubscriber &s) noexcept
+    {
+        if (!s.taken_) return;
+        s.tail_ = (s.tail_ + s.taken_) % s.cap_;
+        s.count_ -= s.taken_;
+        s.taken_ = 0u;
+        if (s.blocked_ && s.free_slots() >= s.width_) {
+            s.blocked_ = false;
+            blocked_--;
+        }
+    }
+
+    void touch_(EdgeSubscriber &s) noexcept
+    {
+        if (s.touched_) return;
+        s.touched_ = true;
+        s.next_touched_ = touched_;
+        touched_ = &s;
+    }
+
+    // Resumes waiting consumers with a full batch, a full ring, or (with `all`) any event.
+    void wake_(bool all) noexcept
+    {
+        EdgeSubscriber *list = std::exchange(touched_, nullptr);
+        while (list) {
+            EdgeSubscriber *s = list;
+            list = s->next_touched_;
+            s->touched_ = false;
+            if (s->waiter_ && (s->count_ >= s->batch_ || s->blocked_ || all)) {
+                std::exchange(s->waiter_, nullptr).resume();
+            } else if (s->count_) {
+                touch_(*s);
+            }
+        }
+    }
+
+    // Coroutine to continue with when a consumer or the producer suspends.
+    std::coroutine_handle<> next_runnable_() noexcept
+    {
+        if (!producer_) return std::noop_coroutine();
+        if (blocked_ == 0u || closed_) return std::exchange(producer_, nullptr);
+        for (EdgeSubscriber *s = touched_; s; s = s->next_touched_)
+            if (s->blocked_ && s->waiter_) return std::exchange(s->waiter_, nullptr);
+        return std::noop_coroutine();
+    }
+
+    ::EdgeArray *arr_;
+    EdgeSubscriber **routes_;
+    std::uint32_t channels_;
+    std::uint32_t blocked_ = 0u;        // Subscribers without room for a row
+    std::uint64_t step_ = 0u;
+    EdgeSubscriber *touched_ = nullptr; // Subscribers holding events
+    std::coroutine_handle<> producer_;  // Producer suspended in writable()
+    bool closed_ = false;
+};
+
+/** @brief Awaitable returned by `EdgeSubscriber::next()`. */
+class EdgeSubscriber::NextBatch {
+public:
+    explicit NextBatch(EdgeSubscriber &s) noexcept : s_(&s) {}
+
+    bool await_ready() noexcept
+    {
+        if (!s_->stream_) return true;
+        s_->stream_->release_(*s_);
+        if (std::exchange(s_->split_, false) && s_->count_) return true;   // Rest of the batch
+        return s_->count_ >= s_->batch_ || s_->stream_->closed_;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> h) noexcept
+    {
+        s_->waiter_ = h;
+        if (s_->count_) s_->stream_->touch_(*s_);   // Eligible for flush()
+        return s_->stream_->next_runnable_();
+    }
+
+    std::span<const EdgeStreamEvent> await_resume() noexcept
+    {
+        if (!s_->stream_ || !s_->count_) return {};
+        std::size_t n = s_->cap_ - s_->tail_;       // Contiguous part of the ring
+        if (n > s_->count_) n = s_->count_;
+        s_->split_ = (n < s_->count_);
+        s_->taken_ = n;
+        return { s_->buf_ + s_->tail_, n };
+    }
+
+private:
+    EdgeSubscriber *s_;
+};
+
+/** @brief Awaitable returned by `EdgeStream::writable()`. */
+class EdgeStream::Writable {
+public:
+    explicit Writable(EdgeStream &s) noexcept : s_(&s) {}
+
+    bool await_ready() const noexcept { return s_->blocked_ == 0u || s_->closed_; }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> h) noexcept
+    {
+        s_->producer_ = h;
+        std::coroutine_handle<> next = s_->next_runnable_();
+        // No blocked consumer is waiting: they are busy and will call next()
+        return next;
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    EdgeStream *s_;
+};
+
+inline EdgeSubscriber::~EdgeSubscriber()
+{
+    if (stream_) stream_->unsubscribe(*this);
+}
+
+inline EdgeSubscriber::NextBatch EdgeSubscriber::next() noexcept
+{
+    return NextBatch(*this);
+}
+
+inline EdgeStream::Writable EdgeStream::writable() noexcept
+{
+    return Writable(*this);
+}
+
+} // namespace clib
+
+#endif /* EDGE_STREAM_HPP */
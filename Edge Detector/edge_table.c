@@ -0,0 +1,120 @@
+/**
+ * @file    edge_table.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the ROM-able edge detection table.
+ * @license MIT
+ *
+ * @details
+ * The XOR with the idle level is applied when a word is loaded and
+ * stored, so the edge logic itself is the same as in edge_array.c and
+ * the descriptor is never written.
+ */
+
+#include "edge_table.h"
+#include "../Common/bit_ops.h"
+
+/**
+ * @brief Mask of the valid channels of a word.
+ */
+static inline uint64_t _edge_table_valid(const EdgeTable *t, uint32_t word)
+{
+    uint32_t first = word * 64u;
+    if (first >= t->channels) return 0u;
+    return bit_mask64(t->channels - first);
+}
+
+/**
+ * @brief Idle levels of a word.
+ */
+static inline uint64_t _edge_table_idle(const EdgeTable *t, uint32_t word)
+{
+    return t->idle ? t->idle[word] : 0u;
+}
+
+/**
+ * @brief Counts one kind of edge on every set bit of `mask`.
+ */
+static inline void _edge_table_count(const EdgeTable *t, uint32_t word, uint64_t mask, EdgeType type)
+{
+    uint32_t *counters = (type == EDGE_RISING) ? t->rise_count : t->fall_count;
+
+    while (mask) {
+        uint32_t channel = word * 64u + bit_ctz64(mask);
+        mask &= mask - 1u;
+        counters[channel]++;
+        if (t->on_edge)
+            t->on_edge(t->ctx, type, channel);
+    }
+}
+
+uint64_t edge_table_update_word(const EdgeTable *t, uint32_t word, uint64_t sample)
+{
+    if (!t || word >= EDGE_TABLE_WORDS(t->channels)) return 0u;
+
+    uint64_t idle = _edge_table_idle(t, word);
+    uint64_t valid = _edge_table_valid(t, word);
+    sample &= valid;
+    uint64_t changed = ((t->level[word] ^ idle) ^ sample) & valid;
+    t->level[word] = (sample ^ idle) & valid;
+
+    if (!t->on_edge) {
+        _edge_table_count(t, word, changed & sample, EDGE_RISING);
+        _edge_table_count(t, word, changed & ~sample, EDGE_FALLING);
+        return changed;
+    }
+
+    /* Callbacks are delivered in channel order. */
+    uint64_t pending = changed;
+    while (pending) {
+        uint64_t lowest = pending & (~pending + 1u);
+        pending &= pending - 1u;
+        _edge_table_count(t, word, lowest, (sample & lowest) ? EDGE_RISING : EDGE_FALLING);
+    }
+    return changed;
+}
+
+EdgeType edge_table_update(const EdgeTable *t, uint32_t channel, uint8_t input)
+{
+    if (!t || channel >= t->channels) return EDGE_NONE;
+
+    uint32_t word = channel / 64u;
+    uint64_t bit = (uint64_t)1u << (channel % 64u);
+    uint64_t level = t->level[word] ^ _edge_table_idle(t, word);
+    uint64_t sample = (input != 0u) ? (level | bit) : (level & ~bit);
+    uint64_t changed = edge_table_update_word(t, word, sample);
+
+    if (!(changed & bit)) return EDGE_NONE;
+    return (input != 0u) ? EDGE_RISING : EDGE_FALLING;
+}
+
+uint8_t edge_table_level(const EdgeTable *t, uint32_t channel)
+{
+    if (!t || channel >= t->channels) return 0u;
+    uint32_t word = channel / 64u;
+    return (uint8_t)(((t->level[word] ^ _edge_table_idle(t, word)) >> (channel % 64u)) & 1u);
+}
+
+void edge_table_reset(const EdgeTable *t)
+{
+    if (!t) return;
+    for (uint32_t w = 0; w < EDGE_TABLE_WORDS(t->channels); w++)
+        t->level[w] = 0u;
+    for (uint32_t c = 0; c < t->channels; c++) {
+        t->rise_count[c] = 0u;
+        t->fall_count[c] = 0u;
+    }
+}
+
+uint32_t edge_table_get_rise_count(const EdgeTable *t, uint32_t channel)
+{
+    if (!t || channel >= t->channels) return 0u;
+    return t->rise_count[channel];
+}
+
+uint32_t edge_table_get_fall_count(const EdgeTable *t, uint32_t channel)
+{
+    if (!t || channel >= t->channels) return 0u;
+    return t->fall_count[channel];
+}
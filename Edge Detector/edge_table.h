@@ -0,0 +1,145 @@
+/**
+ * @file    edge_table.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   ROM-able edge detection table with zero-initialized state.
+ * @license MIT
+ *
+ * @details
+ * An EdgeTable splits a channel bank into a `const` descriptor, which the
+ * linker places in flash, and mutable state arrays that live in `.bss`:
+ * - descriptor: state array addresses, idle levels, callback, context,
+ *   channel count (all constant after build),
+ * - state: levels packed 64 per word and stored XOR the idle level, plus
+ *   rising and falling counters.
+ *
+ * Because levels are stored relative to the idle level, all-zero state
+ * means "every channel at its idle level, no edges yet": the C startup
+ * code's `.bss` clear is the initialization, there is no init call and no
+ * per-channel loop at boot. Only the state arrays use RAM.
+ *
+ * Typical usage:
+ * @code
+ * static const uint64_t door_idle[EDGE_TABLE_WORDS(1000)] = { ... }; // pull-ups
+ * EDGE_TABLE_DEFINE(doors, 1000, door_idle, 0, 0);
+ * ...
+ * for (uint32_t w = 0; w < EDGE_TABLE_WORDS(1000); w++)
+ *     edge_table_update_word(&doors, w, read_port64(w));
+ * uint32_t opened = edge_table_get_rise_count(&doors, 42);
+ * @endcode
+ */
+
+#ifndef EDGE_TABLE_H
+#define EDGE_TABLE_H
+
+#include <stdint.h>
+
+#include "edge_detector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Number of 64-bit state words needed for `n` channels. */
+#define EDGE_TABLE_WORDS(n) (((n) + 63u) / 64u)
+
+/**
+ * @struct EdgeTable
+ * @brief Constant descriptor of a channel bank (place it in flash).
+ *
+ * @var EdgeTable::level
+ *      State: current level XOR idle level, channel c is bit (c % 64) of word (c / 64).
+ * @var EdgeTable::rise_count
+ *      State: rising edge counter per channel.
+ * @var EdgeTable::fall_count
+ *      State: falling edge counter per channel.
+ * @var EdgeTable::idle
+ *      Idle (power-on) level per channel, packed like `level`, or NULL for all low.
+ * @var EdgeTable::on_edge
+ *      Optional callback shared by all channels (id = channel number).
+ * @var EdgeTable::ctx
+ *      User context passed to `on_edge`.
+ * @var EdgeTable::channels
+ *      Number of channels.
+ */
+typedef struct {
+    uint64_t *level;
+    uint32_t *rise_count;
+    uint32_t *fall_count;
+    const uint64_t *idle;
+    EdgeCallback on_edge;
+    void *ctx;
+    uint32_t channels;
+} EdgeTable;
+
+/**
+ * @def EDGE_TABLE_DEFINE(name, n, idle_words, fn, user_ctx)
+ * @brief Defines zero-initialized state for `n` channels and a constant
+ *        EdgeTable `name` describing it.
+ */
+#define EDGE_TABLE_DEFINE(name, n, idle_words, fn, user_ctx)                  \
+    static uint64_t name##_level[EDGE_TABLE_WORDS(n)];                        \
+    static uint32_t name##_rise[(n)];                                         \
+    static uint32_t name##_fall[(n)];                                         \
+    static const EdgeTable name = { name##_level, name##_rise, name##_fall,   \
+                                    (idle_words), (fn), (user_ctx), (n) }
+
+/**
+ * @brief Updates 64 channels at once.
+ * @param t Pointer to the EdgeTable descriptor.
+ * @param word Word index (channels 64*word .. 64*word+63).
+ * @param sample Current samples of those channels (bit N = channel 64*word+N).
+ * @return Mask of the channels that changed.
+ *
+ * @details
+ * Same semantics as `edge_array_update_word()`; bits beyond `channels`
+ * are ignored.
+ */
+uint64_t edge_table_update_word(const EdgeTable *t, uint32_t word, uint64_t sample);
+
+/**
+ * @brief Updates a single channel.
+ * @param t Pointer to the EdgeTable descriptor.
+ * @param channel Channel number.
+ * @param input Current signal value (0 or 1).
+ * @return EdgeType: EDGE_NONE, EDGE_RISING, or EDGE_FALLING.
+ */
+EdgeType edge_table_update(const EdgeTable *t, uint32_t channel, uint8_t input);
+
+/**
+ * @brief Current level of a channel.
+ * @param t Pointer to the EdgeTable descriptor.
+ * @param channel Channel number.
+ * @return 0 or 1 (0 for invalid arguments).
+ */
+uint8_t edge_table_level(const EdgeTable *t, uint32_t channel);
+
+/**
+ * @brief Returns every channel to its idle level and clears the counters.
+ * @param t Pointer to the EdgeTable descriptor.
+ * @note Equivalent to the power-on state; never needed at boot.
+ */
+void edge_table_reset(const EdgeTable *t);
+
+/**
+ * @brief Retrieves the rising edge count of a channel.
+ * @param t Pointer to the EdgeTable descriptor.
+ * @param channel Channel number.
+ * @return Number of rising edges detected, 0 for invalid arguments.
+ */
+uint32_t edge_table_get_rise_count(const EdgeTable *t, uint32_t channel);
+
+/**
+ * @brief Retrieves the falling edge count of a channel.
+ * @param t Pointer to the EdgeTable descriptor.
+ * @param channel Channel number.
+ * @return Number of falling edges detected, 0 for invalid arguments.
+ */
+uint32_t edge_table_get_fall_count(const EdgeTable *t, uint32_t channel);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_TABLE_H */
@@ -0,0 +1,96 @@
+/**
+ * @file    edge_timing.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the edge timing statistics.
+ * @license MIT
+ *
+ * @details
+ * Every edge costs one subtraction and, with EMA enabled, one rounded
+ * shift per affected estimate. The first measurement of each estimate
+ * seeds the average, so there is no start-up ramp from 0.
+ */
+
+#include "edge_timing.h"
+
+/* EdgeTiming::seen flags */
+#define EDGE_TIMING_SEEN_RISE 0x01u
+#define EDGE_TIMING_SEEN_FALL 0x02u
+
+/**
+ * @brief Folds a new measurement into an estimate.
+ */
+static inline uint32_t _edge_timing_blend(const EdgeTiming *t, uint32_t estimate,
+                                          uint32_t sample, uint8_t flag)
+{
+    if (!t->ema_shift || !(t->valid & flag)) return sample;
+
+    uint32_t half = 1u << (t->ema_shift - 1u);
+    if (sample >= estimate)
+        return estimate + ((sample - estimate + half) >> t->ema_shift);
+    return estimate - ((estimate - sample + half) >> t->ema_shift);
+}
+
+void edge_timing_init(EdgeTiming *t, uint8_t ema_shift)
+{
+    if (!t) return;
+    t->ema_shift = (ema_shift > EDGE_TIMING_MAX_SHIFT) ? (uint8_t)EDGE_TIMING_MAX_SHIFT : ema_shift;
+    edge_timing_reset(t);
+}
+
+void edge_timing_record(EdgeTiming *t, uint8_t level, uint32_t timestamp)
+{
+    if (!t) return;
+
+    if (level) {
+        if (t->seen & EDGE_TIMING_SEEN_FALL) {
+            t->low_time = _edge_timing_blend(t, t->low_time, timestamp - t->last_fall, EDGE_TIMING_LOW);
+            t->valid |= EDGE_TIMING_LOW;
+        }
+        if (t->seen & EDGE_TIMING_SEEN_RISE) {
+            t->period = _edge_timing_blend(t, t->period, timestamp - t->last_rise, EDGE_TIMING_PERIOD);
+            t->valid |= EDGE_TIMING_PERIOD;
+        }
+        t->last_rise = timestamp;
+        t->seen |= EDGE_TIMING_SEEN_RISE;
+    }
+    else {
+        if (t->seen & EDGE_TIMING_SEEN_RISE) {
+            t->high_time = _edge_timing_blend(t, t->high_time, timestamp - t->last_rise, EDGE_TIMING_HIGH);
+            t->valid |= EDGE_TIMING_HIGH;
+        }
+        t->last_fall = timestamp;
+        t->seen |= EDGE_TIMING_SEEN_FALL;
+    }
+}
+
+void edge_timing_reset(EdgeTiming *t)
+{
+    if (!t) return;
+    t->last_rise = 0u;
+    t->last_fall = 0u;
+    t->high_time = 0u;
+    t->low_time = 0u;
+    t->period = 0u;
+    t->seen = 0u;
+    t->valid = 0u;
+}
+
+uint32_t edge_timing_frequency_milli(const EdgeTiming *t, uint32_t tick_hz)
+{
+    uint32_t period = edge_timing_period(t);
+    if (!period) return 0u;
+
+    uint64_t f = ((uint64_t)tick_hz * 1000u + period / 2u) / period;
+    return (f > UINT32_MAX) ? UINT32_MAX : (uint32_t)f;
+}
+
+uint16_t edge_timing_duty_permille(const EdgeTiming *t)
+{
+    uint64_t high = edge_timing_high(t);
+    uint64_t total = high + edge_timing_low(t);
+    if (!t || !(t->valid & EDGE_TIMING_HIGH) || !(t->valid & EDGE_TIMING_LOW) || !total) return 0u;
+
+    return (uint16_t)((high * 1000u + total / 2u) / total);
+}
@@ -0,0 +1,159 @@
+/**
+ * @file    edge_timing.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Pulse-width, period and frequency measurement from edge timestamps.
+ * @license MIT
+ *
+ * @details
+ * An EdgeTiming attached to an EdgeDetector is updated on every edge with
+ * the timestamp of the sample: the one passed to `edge_update_at()` or
+ * `edge_update_buffer_at()` / `edge_update_packed_at()`, otherwise the
+ * detector's sample clock (see `edge_update()`). Intervals therefore span
+ * buffer boundaries, and tachometer and PWM feedback need neither a
+ * callback nor a post-processing pass:
+ * - high time:  rising  -> falling,
+ * - low time:   falling -> rising,
+ * - period:     rising  -> rising.
+ *
+ * Estimates are either the last measured value or an exponential moving
+ * average with weight 1/2^ema_shift (integer, so an average settles within
+ * 2^(ema_shift-1) ticks of the true mean). Timestamps are free-running 32-bit
+ * ticks; wrap-around is handled as long as one interval fits in 32 bits.
+ *
+ * Typical usage:
+ * @code
+ * EdgeDetector tach;
+ * EdgeHooks tach_hooks;
+ * EdgeTiming tach_timing;
+ * edge_init(&tach, 0);
+ * edge_attach_hooks(&tach, &tach_hooks);
+ * edge_timing_init(&tach_timing, 3);         // EMA over ~8 periods
+ * edge_attach_timing(&tach, &tach_timing);
+ * ...
+ * edge_update_at(&tach, read_pin(), TIM2->CNT);
+ * uint32_t rpm_x1000 = edge_timing_frequency_milli(&tach_timing, 1000000u) * 60u;
+ * @endcode
+ */
+
+#ifndef EDGE_TIMING_H
+#define EDGE_TIMING_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Largest supported EMA shift. */
+#define EDGE_TIMING_MAX_SHIFT 15u
+
+/** @brief EdgeTiming::valid flag: high_time holds a measurement. */
+#define EDGE_TIMING_HIGH   0x01u
+/** @brief EdgeTiming::valid flag: low_time holds a measurement. */
+#define EDGE_TIMING_LOW    0x02u
+/** @brief EdgeTiming::valid flag: period holds a measurement. */
+#define EDGE_TIMING_PERIOD 0x04u
+
+/**
+ * @struct EdgeTiming
+ * @brief Incremental timing statistics of one signal.
+ *
+ * @var EdgeTiming::last_rise
+ *      Timestamp of the last rising edge.
+ * @var EdgeTiming::last_fall
+ *      Timestamp of the last falling edge.
+ * @var EdgeTiming::high_time
+ *      High-time estimate in ticks.
+ * @var EdgeTiming::low_time
+ *      Low-time estimate in ticks.
+ * @var EdgeTiming::period
+ *      Period estimate (rising to rising) in ticks.
+ * @var EdgeTiming::ema_shift
+ *      0 = keep the last measurement, N = EMA with weight 1/2^N.
+ * @var EdgeTiming::seen
+ *      Internal: which edge directions have been seen.
+ * @var EdgeTiming::valid
+ *      Combination of EDGE_TIMING_HIGH, EDGE_TIMING_LOW and EDGE_TIMING_PERIOD.
+ */
+typedef struct EdgeTiming {
+    uint32_t last_rise;
+    uint32_t last_fall;
+    uint32_t high_time;
+    uint32_t low_time;
+    uint32_t period;
+    uint8_t ema_shift;
+    uint8_t seen;
+    uint8_t valid;
+} EdgeTiming;
+
+/**
+ * @brief Initializes the statistics.
+ * @param t Pointer to the EdgeTiming instance.
+ * @param ema_shift 0 for the last measurement, otherwise the EMA shift
+ *                  (clamped to EDGE_TIMING_MAX_SHIFT).
+ */
+void edge_timing_init(EdgeTiming *t, uint8_t ema_shift);
+
+/**
+ * @brief Records one edge (called by the detector; usable standalone).
+ * @param t Pointer to the EdgeTiming instance.
+ * @param level Level after the edge: 1 = rising, 0 = falling.
+ * @param timestamp Time of the edge.
+ */
+void edge_timing_record(EdgeTiming *t, uint8_t level, uint32_t timestamp);
+
+/**
+ * @brief Clears all measurements (the EMA shift is kept).
+ * @param t Pointer to the EdgeTiming instance.
+ */
+void edge_timing_reset(EdgeTiming *t);
+
+/**
+ * @brief Frequency estimate in millihertz.
+ * @param t Pointer to the EdgeTiming instance.
+ * @param tick_hz Frequency of the timestamp clock.
+ * @return 1000 * tick_hz / period, or 0 while no period was measured.
+ */
+uint32_t edge_timing_frequency_milli(const EdgeTiming *t, uint32_t tick_hz);
+
+/**
+ * @brief Duty cycle estimate in permille.
+ * @param t Pointer to the EdgeTiming instance.
+ * @return 1000 * high / (high + low), or 0 while either is unmeasured.
+ */
+uint16_t edge_timing_duty_permille(const EdgeTiming *t);
+
+/**
+ * @brief High-time estimate in ticks (0 until measured).
+ * @param t Pointer to the EdgeTiming instance.
+ */
+static inline uint32_t edge_timing_high(const EdgeTiming *t)
+{
+    return (t && (t->valid & EDGE_TIMING_HIGH)) ? t->high_time : 0u;
+}
+
+/**
+ * @brief Low-time estimate in ticks (0 until measured).
+ * @param t Pointer to the EdgeTiming instance.
+ */
+static inline uint32_t edge_timing_low(const EdgeTiming *t)
+{
+    return (t && (t->valid & EDGE_TIMING_LOW)) ? t->low_time : 0u;
+}
+
+/**
+ * @brief Period estimate in ticks (0 until measured).
+ * @param t Pointer to the EdgeTiming instance.
+ */
+static inline uint32_t edge_timing_period(const EdgeTiming *t)
+{
+    return (t && (t->valid & EDGE_TIMING_PERIOD)) ? t->period : 0u;
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* EDGE_TIMING_H */
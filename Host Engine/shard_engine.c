@@ -0,0 +1,196 @@
+/**
+ * @file    shard_engine.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the sharded host engine.
+ * @license MIT
+ *
+ * @details
+ * Workers sleep on a condition variable between blocks: the caller
+ * publishes a block and bumps `generation`, every worker scans its shard
+ * of every row (time outer, words inner, so the shard state stays in the
+ * worker's cache), and the last one to finish wakes the caller. With
+ * static partitioning there is no shared state on the hot path at all.
+ */
+
+#include "shard_engine.h"
+#include "../Common/bit_ops.h"
+
+/** EdgeArray words per cache line of `prev`. */
+#define SHARD_WORDS_PER_LINE (SHARD_ENGINE_CACHE_LINE / sizeof(uint64_t))
+
+/**
+ * @brief True if word `w` starts a cache line in every per-word array.
+ */
+static uint8_t _shard_line_start(const ShardEngine *e, uint32_t w)
+{
+    const EdgeArray *arr = e->edges;
+    uintptr_t line = SHARD_ENGINE_CACHE_LINE;
+
+    if ((uintptr_t)(arr->prev + w) % line) return 0u;
+    if ((uintptr_t)(arr->rise_count + (size_t)w * 64u) % line) return 0u;
+    if ((uintptr_t)(arr->fall_count + (size_t)w * 64u) % line) return 0u;
+    if (e->ports && (uintptr_t)(e->ports + w) % line) return 0u;
+    return 1u;
+}
+
+/**
+ * @brief First word at or after `w` where a shard may start.
+ *
+ * Every array repeats its line phase within 64 words; when no word lines
+ * up all of them (storage not line aligned), `w` itself is used.
+ */
+static uint32_t _shard_boundary(const ShardEngine *e, uint32_t w)
+{
+    for (uint32_t k = 0; k < 64u; k++) {
+        if (w + k >= e->words) return e->words;
+        if (_shard_line_start(e, w + k)) return w + k;
+    }
+    return w;
+}
+
+/**
+ * @brief Scans the worker's shard over all rows of the current block.
+ */
+static void _shard_scan(ShardWorker *wk)
+{
+    ShardEngine *e = wk->engine;
+    EdgeArray *arr = e->edges;
+    DebouncePort *ports = e->ports;
+    uint64_t rises = 0u;
+    uint64_t falls = 0u;
+
+    for (size_t t = 0; t < e->nsamples; t++) {
+        const uint64_t *row = e->samples + t * e->words;
+        for (uint32_t w = wk->first_word; w < wk->end_word; w++) {
+            uint64_t sample = ports ? debounce_port_update(&ports[w], row[w]) : row[w];
+            uint64_t changed = edge_array_update_word(arr, w, sample);
+            uint32_t up = bit_popcount64(changed & sample);
+            rises += up;
+            falls += bit_popcount64(changed) - up;
+        }
+    }
+
+    wk->rises = rises;
+    wk->falls = falls;
+}
+
+static void *_shard_worker(void *arg)
+{
+    ShardWorker *wk = (ShardWorker *)arg;
+    ShardEngine *e = wk->engine;
+    uint32_t seen = 0u;
+
+    pthread_mutex_lock(&e->lock);
+    for (;;) {
+        while (!e->stop && e->generation == seen)
+            pthread_cond_wait(&e->start, &e->lock);
+        if (e->stop) break;
+        seen = e->generation;
+        pthread_mutex_unlock(&e->lock);
+
+        _shard_scan(wk);
+
+        pthread_mutex_lock(&e->lock);
+        if (--e->pending == 0u)
+            pthread_cond_signal(&e->done);
+    }
+    pthread_mutex_unlock(&e->lock);
+    return 0;
+}
+
+uint8_t shard_engine_start(ShardEngine *engine, EdgeArray *edges, DebouncePort *ports, uint32_t threads)
+{
+    if (!engine || !edges || !edges->channels) return 0u;
+
+    uint32_t words = EDGE_ARRAY_WORDS(edges->channels);
+    uint32_t lines = (uint32_t)((words + SHARD_WORDS_PER_LINE - 1u) / SHARD_WORDS_PER_LINE);
+    if (threads == 0u) threads = 1u;
+    if (threads > SHARD_ENGINE_MAX_THREADS) threads = SHARD_ENGINE_MAX_THREADS;
+    if (threads > lines) threads = lines;
+
+    engine->edges = edges;
+    engine->ports = ports;
+    engine->samples = 0;
+    engine->nsamples = 0u;
+    engine->total_rises = 0u;
+    engine->total_falls = 0u;
+    engine->words = words;
+    engine->thread_count = 0u;
+    engine->generation = 0u;
+    engine->pending = 0u;
+    engine->stop = 0u;
+    pthread_mutex_init(&engine->lock, 0);
+    pthread_cond_init(&engine->start, 0);
+    pthread_cond_init(&engine->done, 0);
+
+    uint32_t first = 0u;
+    for (uint32_t k = 0; k < threads; k++) {
+        ShardWorker *wk = &engine->workers[k];
+        uint32_t end = (uint32_t)(((uint64_t)lines * (k + 1u) / threads) * SHARD_WORDS_PER_LINE);
+        end = (k + 1u == threads) ? words : _shard_boundary(engine, (end < words) ? end : words);
+        wk->first_word = first;
+        wk->end_word = (end > first) ? end : first;
+        first = wk->end_word;
+        wk->rises = 0u;
+        wk->falls = 0u;
+        wk->engine = engine;
+        if (pthread_create(&wk->thread, 0, _shard_worker, wk) != 0) {
+            shard_engine_stop(engine);
+            return 0u;
+        }
+        engine->thread_count++;
+    }
+    return 1u;
+}
+
+uint64_t shard_engine_process(ShardEngine *engine, const uint64_t *samples, size_t nsamples)
+{
+    if (!engine || !engine->thread_count || !samples || !nsamples) return 0u;
+
+    pthread_mutex_lock(&engine->lock);
+    engine->samples = samples;
+    engine->nsamples = nsamples;
+    engine->pending = engine->thread_count;
+    engine->generation++;
+    pthread_cond_broadcast(&engine->start);
+    while (engine->pending)
+        pthread_cond_wait(&engine->done, &engine->lock);
+    pthread_mutex_unlock(&engine->lock);
+
+    /* Merge the per-thread totals of this block */
+    uint64_t rises = 0u;
+    uint64_t falls = 0u;
+    for (uint32_t k = 0; k < engine->thread_count; k++) {
+        rises += engine->workers[k].rises;
+        falls += engine->workers[k].falls;
+    }
+    engine->total_rises += rises;
+    engine->total_falls += falls;
+    return rises + falls;
+}
+
+void shard_engine_stop(ShardEngine *engine)
+{
+    if (!engine) return;
+
+    pthread_mutex_lock(&engine->lock);
+    engine->stop = 1u;
+    pthread_cond_broadcast(&engine->start);
+    pthread_mutex_unlock(&engine->lock);
+
+    for (uint32_t k = 0; k < engine->thread_count; k++)
+        pthread_join(engine->workers[k].thread, 0);
+    engine->thread_count = 0u;
+
+    pthread_cond_destroy(&engine->done);
+    pthread_cond_destroy(&engine->start);
+    pthread_mutex_destroy(&engine->lock);
+}
+
+void shard_engine_totals(const ShardEngine *engine, uint64_t *rises, uint64_t *falls)
+{
+    if (rises) *rises = engine ? engine->total_rises : 0u;
+    if (falls) *falls = engine ? engine->total_falls : 0u;
+}
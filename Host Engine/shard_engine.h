@@ -0,0 +1,160 @@
+/**
+ * @file    shard_engine.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Multithreaded processing of large signal banks on POSIX hosts.
+ * @license MIT
+ *
+ * @details
+ * Replays captured traces of thousands of channels through an EdgeArray
+ * (and optionally one DebouncePort per 64 channels in front of it) on a
+ * pool of worker threads. The channel words are statically partitioned
+ * into one contiguous shard per thread. A shard starts where `prev`, both
+ * counter arrays and the DebouncePorts all start a cache line (every 8
+ * words = 512 channels when they are line aligned), so no two threads
+ * ever write the same line: state and counters of a channel are only
+ * touched by the thread that owns it. Per-thread totals live in
+ * cache-line aligned slots and are merged when a block completes.
+ *
+ * Align the caller's arrays to SHARD_ENGINE_CACHE_LINE: otherwise no
+ * boundary lines all of them up and the shards fall back to the nominal
+ * split, with some lines shared at the boundaries.
+ *
+ * Samples are given time-major, one row of EDGE_ARRAY_WORDS(channels)
+ * words per time step, exactly as `edge_array_update_word()` consumes them:
+ * @code
+ * static ShardEngine engine;
+ * shard_engine_start(&engine, &inputs, ports, 16);   // ports may be NULL
+ * while (read_block(rows, &n))
+ *     shard_engine_process(&engine, rows, n);
+ * shard_engine_stop(&engine);
+ * @endcode
+ *
+ * Host only: requires POSIX threads. A callback set on the EdgeArray is
+ * invoked concurrently from the worker threads; an EdgeRate is not thread
+ * safe and must not be attached while the engine runs.
+ */
+
+#ifndef SHARD_ENGINE_H
+#define SHARD_ENGINE_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../Edge Detector/edge_array.h"
+#include "../Debounce Signal/debounce_port.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Maximum number of worker threads. */
+#ifndef SHARD_ENGINE_MAX_THREADS
+#define SHARD_ENGINE_MAX_THREADS 64u
+#endif
+
+/** @brief Cache line size used for shard alignment and padding. */
+#ifndef SHARD_ENGINE_CACHE_LINE
+#define SHARD_ENGINE_CACHE_LINE 64u
+#endif
+
+/**
+ * @struct ShardWorker
+ * @brief Shard and running totals of one worker thread.
+ *
+ * Each worker occupies whole cache lines so that the totals written by one
+ * thread never share a line with another thread's.
+ */
+typedef struct {
+    uint64_t rises;         /**< Rising edges counted in the current block. */
+    uint64_t falls;         /**< Falling edges counted in the current block. */
+    uint32_t first_word;    /**< First EdgeArray word of the shard. */
+    uint32_t end_word;      /**< One past the last word of the shard. */
+    struct ShardEngine *engine;     /**< Owning engine. */
+    pthread_t thread;       /**< Worker thread handle. */
+} __attribute__((aligned(SHARD_ENGINE_CACHE_LINE))) ShardWorker;
+
+/**
+ * @struct ShardEngine
+ * @brief Thread pool bound to one EdgeArray.
+ *
+ * @var ShardEngine::workers
+ *      Per-thread shards and totals.
+ * @var ShardEngine::edges
+ *      Channel bank being processed.
+ * @var ShardEngine::ports
+ *      Optional debounce stage, one DebouncePort per EdgeArray word.
+ * @var ShardEngine::samples
+ *      Rows of the block being processed.
+ * @var ShardEngine::nsamples
+ *      Number of rows in the block.
+ * @var ShardEngine::total_rises
+ *      Rising edges of all blocks since start.
+ * @var ShardEngine::total_falls
+ *      Falling edges of all blocks since start.
+ */
+typedef struct ShardEngine {
+    ShardWorker workers[SHARD_ENGINE_MAX_THREADS];
+    EdgeArray *edges;
+    DebouncePort *ports;
+    const uint64_t *samples;
+    size_t nsamples;
+    uint64_t total_rises;
+    uint64_t total_falls;
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    uint32_t words;         /**< Words per row, EDGE_ARRAY_WORDS(channels). */
+    uint32_t thread_count;  /**< Number of running workers. */
+    uint32_t generation;    /**< Incremented for every block. */
+    uint32_t pending;       /**< Workers still busy with the current block. */
+    uint8_t stop;           /**< Set to terminate the workers. */
+} ShardEngine;
+
+/**
+ * @brief Partitions the bank and starts the worker threads.
+ * @param engine Pointer to the ShardEngine instance.
+ * @param edges Initialized EdgeArray.
+ * @param ports Optional array of EDGE_ARRAY_WORDS(channels) initialized
+ *              DebouncePorts applied before edge detection, or NULL.
+ * @param threads Number of worker threads (clamped to 1..SHARD_ENGINE_MAX_THREADS
+ *                and to the number of cache-line shards).
+ * @return 1 on success, 0 on invalid arguments or thread creation failure.
+ */
+uint8_t shard_engine_start(ShardEngine *engine, EdgeArray *edges, DebouncePort *ports, uint32_t threads);
+
+/**
+ * @brief Processes one block of samples in parallel and waits for it.
+ * @param engine Pointer to a started ShardEngine.
+ * @param samples `nsamples` rows of `engine->words` words, time-major.
+ * @param nsamples Number of time steps in the block.
+ * @return Number of edges (rising + falling) in the block.
+ *
+ * @details
+ * Same result as calling `edge_array_update_word()` (after
+ * `debounce_port_update()` when ports are attached) for every word of
+ * every row in order.
+ */
+uint64_t shard_engine_process(ShardEngine *engine, const uint64_t *samples, size_t nsamples);
+
+/**
+ * @brief Stops and joins the worker threads.
+ * @param engine Pointer to a started ShardEngine.
+ */
+void shard_engine_stop(ShardEngine *engine);
+
+/**
+ * @brief Returns the edge totals of all blocks since start.
+ * @param engine Pointer to the ShardEngine instance.
+ * @param rises Destination for the rising edge total (may be NULL).
+ * @param falls Destination for the falling edge total (may be NULL).
+ */
+void shard_engine_totals(const ShardEngine *engine, uint64_t *rises, uint64_t *falls);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SHARD_ENGINE_H */
@@ -0,0 +1,147 @@
+/**
+ * @file    quadrature.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the quadrature encoder decoder.
+ * @license MIT
+ *
+ * @details
+ * The single-encoder path is one table load and one bit test per sample.
+ * The bank computes the same table for 16 pairs in parallel: a pair that
+ * changed exactly one channel moves forward iff the changed channel is A
+ * and A != B, or it is B and A == B (after the change).
+ */
+
+#include "quadrature.h"
+#include "../Common/bit_ops.h"
+
+/** Pair bits holding channel A (bit 2N). */
+#define QUADRATURE_A_BITS 0x55555555u
+
+/** Position delta indexed by (old_state << 2) | new_state. */
+static const int8_t quadrature_delta[16] = {
+     0, +1, -1,  0,
+    -1,  0,  0, +1,
+    +1,  0,  0, -1,
+     0, -1, +1,  0
+};
+
+/** Invalid transitions (both channels changed): 0->3, 1->2, 2->1, 3->0. */
+#define QUADRATURE_INVALID 0x1248u
+
+void quadrature_init(Quadrature *q, uint8_t a, uint8_t b)
+{
+    if (!q) return;
+    q->position = 0;
+    q->errors = 0u;
+    q->state = (uint8_t)(((b != 0u) << 1) | (a != 0u));
+}
+
+int8_t quadrature_update(Quadrature *q, uint8_t a, uint8_t b)
+{
+    return quadrature_update_state(q, (uint8_t)(((b != 0u) << 1) | (a != 0u)));
+}
+
+int8_t quadrature_update_state(Quadrature *q, uint8_t state)
+{
+    if (!q) return 0;
+
+    unsigned idx = ((unsigned)q->state << 2) | (state & 3u);
+    int8_t delta = quadrature_delta[idx];
+    q->position += delta;
+    q->errors += (QUADRATURE_INVALID >> idx) & 1u;
+    q->state = (uint8_t)(state & 3u);
+    return delta;
+}
+
+void quadrature_set_position(Quadrature *q, int32_t position)
+{
+    if (!q) return;
+    q->position = position;
+}
+
+void quadrature_bank_init(QuadratureBank *bank, uint8_t encoders, uint32_t initial_port)
+{
+    if (!bank) return;
+    if (encoders > QUADRATURE_BANK_MAX) encoders = (uint8_t)QUADRATURE_BANK_MAX;
+
+    bank->pairs = (uint32_t)bit_mask64(2u * encoders);
+    bank->prev = initial_port & bank->pairs;
+    bank->forward = 0u;
+    bank->reverse = 0u;
+    bank->invalid = 0u;
+    for (unsigned i = 0; i < QUADRATURE_BANK_MAX; i++) {
+        bank->position[i] = 0;
+        bank->errors[i] = 0u;
+    }
+}
+
+/**
+ * @brief Gathers the even bits of a word into the low 16 bits.
+ */
+static inline uint16_t _quadrature_compress(uint32_t x)
+{
+    x &= QUADRATURE_A_BITS;
+    x = (x | (x >> 1)) & 0x33333333u;
+    x = (x | (x >> 2)) & 0x0F0F0F0Fu;
+    x = (x | (x >> 4)) & 0x00FF00FFu;
+    x = (x | (x >> 8)) & 0x0000FFFFu;
+    return (uint16_t)x;
+}
+
+uint16_t quadrature_bank_update(QuadratureBank *bank, uint32_t port)
+{
+    if (!bank) return 0u;
+
+    port &= bank->pairs;
+    uint32_t changed = bank->prev ^ port;
+    bank->prev = port;
+
+    /* Per pair, aligned on the A bit */
+    uint32_t da = changed & QUADRATURE_A_BITS;
+    uint32_t db = (changed >> 1) & QUADRATURE_A_BITS;
+    uint32_t differ = (port ^ (port >> 1)) & QUADRATURE_A_BITS;   /* A != B */
+    uint32_t single = da ^ db;
+    uint32_t fwd = single & ~(differ ^ da);
+
+    bank->forward = _quadrature_compress(fwd);
+    bank->reverse = _quadrature_compress(single & ~fwd);
+    bank->invalid = _quadrature_compress(da & db);
+
+    uint16_t mask = bank->forward;
+    while (mask) {
+        bank->position[bit_ctz64(mask)]++;
+        mask &= (uint16_t)(mask - 1u);
+    }
+    mask = bank->reverse;
+    while (mask) {
+        bank->position[bit_ctz64(mask)]--;
+        mask &= (uint16_t)(mask - 1u);
+    }
+    mask = bank->invalid;
+    while (mask) {
+        bank->errors[bit_ctz64(mask)]++;
+        mask &= (uint16_t)(mask - 1u);
+    }
+
+    return (uint16_t)(bank->forward | bank->reverse | bank->invalid);
+}
+
+int32_t quadrature_bank_position(const QuadratureBank *bank, uint8_t encoder)
+{
+    if (!bank || encoder >= QUADRATURE_BANK_MAX) return 0;
+    return bank->position[encoder];
+}
+
+uint32_t quadrature_bank_errors(const QuadratureBank *bank, uint8_t encoder)
+{
+    if (!bank || encoder >= QUADRATURE_BANK_MAX) return 0u;
+    return bank->errors[encoder];
+}
+
+void quadrature_bank_set_position(QuadratureBank *bank, uint8_t encoder, int32_t position)
+{
+    if (!bank || encoder >= QUADRATURE_BANK_MAX) return;
+    bank->position[encoder] = position;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file    quadrature.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Table-driven quadrature encoder decoding.
+ * @license MIT
+ *
+ * @details
+ * Decodes the A/B channels of incremental encoders in x4 mode: every
+ * level change of A or B moves the position by one count. The previous
+ * and current 2-bit states index a 16-entry table that yields the delta
+ * (-1, 0, +1) directly; transitions where A and B change together are
+ * impossible for a valid encoder and are counted as errors instead.
+ *
+ * State encoding is (B << 1) | A; forward rotation is the Gray sequence
+ * 00 -> 01 -> 11 -> 10 -> 00 (A leads B).
+ *
+ * QuadratureBank decodes up to 16 encoders from one port read, wired as
+ * pairs: encoder N uses bit 2N for A and bit 2N+1 for B. Direction and
+ * error masks are computed for all pairs at once; only the encoders that
+ * moved are then visited.
+ *
+ * Typical usage:
+ * @code
+ * static QuadratureBank axes;
+ * quadrature_bank_init(&axes, 8, GPIOB->IDR);
+ * void TIM6_IRQHandler(void) { quadrature_bank_update(&axes, GPIOB->IDR); }
+ * int32_t x = quadrature_bank_position(&axes, 0);
+ * @endcode
+ */
+
+#ifndef QUADRATURE_H
+#define QUADRATURE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Maximum number of encoders per bank (2 bits each in 32 bits). */
+#define QUADRATURE_BANK_MAX 16u
+
+/**
+ * @struct Quadrature
+ * @brief State of one encoder.
+ *
+ * @var Quadrature::position
+ *      Accumulated position in counts (x4).
+ * @var Quadrature::errors
+ *      Number of invalid transitions (A and B changed together).
+ * @var Quadrature::state
+ *      Last 2-bit state, (B << 1) | A.
+ */
+typedef struct {
+    int32_t position;
+    uint32_t errors;
+    uint8_t state;
+} Quadrature;
+
+/**
+ * @brief Initializes an encoder at position 0.
+ * @param q Pointer to the Quadrature instance.
+ * @param a Current level of channel A (0 or 1).
+ * @param b Current level of channel B (0 or 1).
+ */
+void quadrature_init(Quadrature *q, uint8_t a, uint8_t b);
+
+/**
+ * @brief Processes one sample of the A/B pair.
+ * @param q Pointer to the Quadrature instance.
+ * @param a Channel A (any non-zero value is 1).
+ * @param b Channel B (any non-zero value is 1).
+ * @return Position delta: -1, 0 or +1 (0 also for an invalid transition).
+ */
+int8_t quadrature_update(Quadrature *q, uint8_t a, uint8_t b);
+
+/**
+ * @brief Processes one sample given as a 2-bit state.
+ * @param q Pointer to the Quadrature instance.
+ * @param state (B << 1) | A; upper bits are ignored.
+ * @return Position delta: -1, 0 or +1.
+ */
+int8_t quadrature_update_state(Quadrature *q, uint8_t state);
+
+/**
+ * @brief Overrides the position (e.g. on an index pulse).
+ * @param q Pointer to the Quadrature instance.
+ * @param position New position in counts.
+ */
+void quadrature_set_position(Quadrature *q, int32_t position);
+
+/**
+ * @brief Returns the position in counts.
+ * @param q Pointer to the Quadrature instance.
+ */
+static inline int32_t quadrature_position(const Quadrature *q)
+{
+    return q ? q->position : 0;
+}
+
+/**
+ * @brief Returns the number of invalid transitions.
+ * @param q Pointer to the Quadrature instance.
+ */
+static inline uint32_t quadrature_errors(const Quadrature *q)
+{
+    return q ? q->errors : 0u;
+}
+
+/**
+ * @struct QuadratureBank
+ * @brief State of up to 16 encoders read from one port.
+ *
+ * @var QuadratureBank::position
+ *      Position of every encoder in counts.
+ * @var QuadratureBank::errors
+ *      Invalid transitions of every encoder.
+ * @var QuadratureBank::prev
+ *      Previous port sample (pairs only).
+ * @var QuadratureBank::pairs
+ *      Mask of the port bits in use.
+ * @var QuadratureBank::forward
+ *      Encoders that moved forward in the last update (bit N = encoder N).
+ * @var QuadratureBank::reverse
+ *      Encoders that moved backward in the last update.
+ * @var QuadratureBank::invalid
+ *      Encoders with an invalid transition in the last update.
+ */
+typedef struct {
+    int32_t position[QUADRATURE_BANK_MAX];
+    uint32_t errors[QUADRATURE_BANK_MAX];
+    uint32_t prev;
+    uint32_t pairs;
+    uint16_t forward;
+    uint16_t reverse;
+    uint16_t invalid;
+} QuadratureBank;
+
+/**
+ * @brief Initializes a bank at position 0.
+ * @param bank Pointer to the QuadratureBank instance.
+ * @param encoders Number of encoders (clamped to QUADRATURE_BANK_MAX).
+ * @param initial_port Current port value.
+ */
+void quadrature_bank_init(QuadratureBank *bank, uint8_t encoders, uint32_t initial_port);
+
+/**
+ * @brief Processes one port read for all encoders.
+ * @param bank Pointer to the QuadratureBank instance.
+ * @param port Port value (bit 2N = A of encoder N, bit 2N+1 = B).
+ * @return Mask of encoders whose state changed (bit N = encoder N),
+ *         including invalid transitions.
+ *
+ * @details
+ * Equivalent to `quadrature_update_state()` on every pair.
+ */
+uint16_t quadrature_bank_update(QuadratureBank *bank, uint32_t port);
+
+/**
+ * @brief Returns the position of one encoder.
+ * @param bank Pointer to the QuadratureBank instance.
+ * @param encoder Encoder number.
+ */
+int32_t quadrature_bank_position(const QuadratureBank *bank, uint8_t encoder);
+
+/**
+ * @brief Returns the invalid transition count of one encoder.
+ * @param bank Pointer to the QuadratureBank instance.
+ * @param encoder Encoder number.
+ */
+uint32_t quadrature_bank_errors(const QuadratureBank *bank, uint8_t encoder);
+
+/**
+ * @brief Overrides the position of one encoder.
+ * @param bank Pointer to the QuadratureBank instance.
+ * @param encoder Encoder number.
+ * @param position New position in counts.
+ */
+void quadrature_bank_set_position(QuadratureBank *bank, uint8_t encoder, int32_t position);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* QUADRATURE_H */
@@ -0,0 +1,234 @@
+/**
+ * @file    schmitt.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the hysteresis comparators.
+ * @license MIT
+ *
+ * @details
+ * With S = "sample >= high", R = "sample <= low" and H = ~(S | R) (hold),
+ * the output is out[i] = S[i] | (H[i] & out[i-1]). That is exactly the
+ * carry recurrence of an adder with generate S and propagate H, so for 64
+ * samples the carries of (S | H) + S + state give out[i-1] at every bit
+ * and out = S | (H & carries). The comparisons are vectorized (unsigned
+ * 16-bit compares via a 0x8000 bias on SSE2, native on NEON); the scalar
+ * path produces the same masks.
+ */
+
+#include "schmitt.h"
+
+#if !defined(SCHMITT_SIMD_DISABLE)
+#  if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#    define SCHMITT_SIMD_SSE2 1
+#    include <emmintrin.h>
+#  elif defined(__aarch64__) && defined(__ARM_NEON)
+#    define SCHMITT_SIMD_NEON 1
+#    include <arm_neon.h>
+#  endif
+#endif
+
+/** Samples resolved per carry chain. */
+#define SCHMITT_BLOCK 64u
+
+/**
+ * @brief Builds the set/reset masks of up to 64 samples (scalar).
+ */
+static void _schmitt_masks_scalar(const uint16_t *p, unsigned n, uint16_t low, uint16_t high,
+                                  uint64_t *set, uint64_t *reset)
+{
+    uint64_t s = 0u, r = 0u;
+    for (unsigned i = 0; i < n; i++) {
+        s |= (uint64_t)(p[i] >= high) << i;
+        r |= (uint64_t)(p[i] <= low) << i;
+    }
+    *set = s;
+    *reset = r;
+}
+
+/**
+ * @brief Builds the set/reset masks of exactly 64 samples.
+ */
+static void _schmitt_masks_block(const uint16_t *p, uint16_t low, uint16_t high,
+                                 uint64_t *set, uint64_t *reset)
+{
+#if defined(SCHMITT_SIMD_SSE2)
+    const __m128i bias = _mm_set1_epi16((short)0x8000);
+    const __m128i hb = _mm_set1_epi16((short)(high ^ 0x8000u));
+    const __m128i lb = _mm_set1_epi16((short)(low ^ 0x8000u));
+    uint64_t below_high = 0u, above_low = 0u;
+
+    for (unsigned q = 0; q < 4u; q++) {
+        __m128i x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p + 16u * q)), bias);
+        __m128i x1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p + 16u * q + 8u)), bias);
+        uint64_t bh = (uint16_t)_mm_movemask_epi8(
+            _mm_packs_epi16(_mm_cmpgt_epi16(hb, x0), _mm_cmpgt_epi16(hb, x1)));
+        uint64_t al = (uint16_t)_mm_movemask_epi8(
+            _mm_packs_epi16(_mm_cmpgt_epi16(x0, lb), _mm_cmpgt_epi16(x1, lb)));
+        below_high |= bh << (16u * q);
+        above_low |= al << (16u * q);
+    }
+    *set = ~below_high;
+    *reset = ~above_low;
+#elif defined(SCHMITT_SIMD_NEON)
+    static const uint8_t weights[8] = { 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u };
+    const uint8x8_t w = vld1_u8(weights);
+    const uint16x8_t vh = vdupq_n_u16(high);
+    const uint16x8_t vl = vdupq_n_u16(low);
+    uint64_t s = 0u, r = 0u;
+
+    for (unsigned g = 0; g < 8u; g++) {
+        uint16x8_t x = vld1q_u16(p + 8u * g);
+        s |= (uint64_t)vaddv_u8(vand_u8(vmovn_u16(vcgeq_u16(x, vh)), w)) << (8u * g);
+        r |= (uint64_t)vaddv_u8(vand_u8(vmovn_u16(vcleq_u16(x, vl)), w)) << (8u * g);
+    }
+    *set = s;
+    *reset = r;
+#else
+    _schmitt_masks_scalar(p, SCHMITT_BLOCK, low, high, set, reset);
+#endif
+}
+
+/**
+ * @brief Resolves the hysteresis of one block.
+ * @return Output levels, bit i = sample i.
+ */
+static inline uint64_t _schmitt_resolve(uint64_t set, uint64_t reset, uint8_t state)
+{
+    uint64_t hold = ~(set | reset);
+    uint64_t a = set | hold;
+    uint64_t carries = (a + set + state) ^ a ^ set;
+    return set | (hold & carries);
+}
+
+/**
+ * @brief Classifies up to 64 samples.
+ */
+static inline uint64_t _schmitt_block(Schmitt *s, const uint16_t *p, unsigned n)
+{
+    uint64_t set, reset;
+    if (n == SCHMITT_BLOCK)
+        _schmitt_masks_block(p, s->low, s->high, &set, &reset);
+    else
+        _schmitt_masks_scalar(p, n, s->low, s->high, &set, &reset);
+
+    uint64_t out = _schmitt_resolve(set, reset, s->state);
+    s->state = (uint8_t)((out >> (n - 1u)) & 1u);
+    return out;
+}
+
+uint8_t schmitt_init(Schmitt *s, uint16_t low, uint16_t high, uint8_t initial_state)
+{
+    if (!s || low >= high) return 0;
+    s->low = low;
+    s->high = high;
+    s->state = initial_state ? 1u : 0u;
+    return 1;
+}
+
+uint8_t schmitt_update(Schmitt *s, uint16_t sample)
+{
+    if (!s) return 0;
+    if (sample >= s->high)     s->state = 1u;
+    else if (sample <= s->low) s->state = 0u;
+    return s->state;
+}
+
+uint8_t schmitt_process(Schmitt *s, const uint16_t *samples, size_t n, uint8_t *levels)
+{
+    if (!s) return 0;
+    if (!samples || !levels) return s->state;
+
+    for (size_t base = 0; base < n; base += SCHMITT_BLOCK) {
+        size_t left = n - base;
+        unsigned valid = (left >= SCHMITT_BLOCK) ? SCHMITT_BLOCK : (unsigned)left;
+        uint64_t out = _schmitt_block(s, samples + base, valid);
+        for (unsigned i = 0; i < valid; i++)
+            levels[base + i] = (uint8_t)((out >> i) & 1u);
+    }
+    return s->state;
+}
+
+uint8_t schmitt_process_packed(Schmitt *s, const uint16_t *samples, size_t n, uint8_t *bits)
+{
+    if (!s) return 0;
+    if (!samples || !bits) return s->state;
+
+    for (size_t base = 0; base < n; base += SCHMITT_BLOCK) {
+        size_t left = n - base;
+        unsigned valid = (left >= SCHMITT_BLOCK) ? SCHMITT_BLOCK : (unsigned)left;
+        uint64_t out = _schmitt_block(s, samples + base, valid);
+        if (valid < SCHMITT_BLOCK) out &= ((uint64_t)1u << valid) - 1u;
+        for (unsigned k = 0; k < (valid + 7u) / 8u; k++)
+            bits[base / 8u + k] = (uint8_t)(out >> (8u * k));
+    }
+    return s->state;
+}
+
+uint8_t schmitt_bank_init(SchmittBank *b, const uint16_t *low, const uint16_t *high,
+                          uint8_t channels, uint64_t initial_state)
+{
+    if (!b || !low || !high || channels == 0u || channels > SCHMITT_BANK_MAX_CHANNELS) return 0;
+    for (uint8_t c = 0; c < channels; c++) {
+        if (low[c] >= high[c]) return 0;
+    }
+    b->low = low;
+    b->high = high;
+    b->channels = channels;
+    b->state = (channels < 64u) ? initial_state & (((uint64_t)1u << channels) - 1u) : initial_state;
+    return 1;
+}
+
+/**
+ * @brief Applies one frame to the bank state.
+ */
+static inline uint64_t _schmitt_bank_frame(SchmittBank *b, const uint16_t *frame)
+{
+    uint64_t set = 0u, reset = 0u;
+    unsigned c = 0u;
+
+#if defined(SCHMITT_SIMD_SSE2)
+    const __m128i bias = _mm_set1_epi16((short)0x8000);
+    for (; c + 8u <= b->channels; c += 8u) {
+        __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(frame + c)), bias);
+        __m128i hb = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(b->high + c)), bias);
+        __m128i lb = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(b->low + c)), bias);
+        uint64_t bh = (uint8_t)_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpgt_epi16(hb, x), _mm_setzero_si128()));
+        uint64_t al = (uint8_t)_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpgt_epi16(x, lb), _mm_setzero_si128()));
+        set |= (~bh & 0xFFu) << c;
+        reset |= (~al & 0xFFu) << c;
+    }
+#elif defined(SCHMITT_SIMD_NEON)
+    static const uint8_t weights[8] = { 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u };
+    const uint8x8_t w = vld1_u8(weights);
+    for (; c + 8u <= b->channels; c += 8u) {
+        uint16x8_t x = vld1q_u16(frame + c);
+        set |= (uint64_t)vaddv_u8(vand_u8(vmovn_u16(vcgeq_u16(x, vld1q_u16(b->high + c))), w)) << c;
+        reset |= (uint64_t)vaddv_u8(vand_u8(vmovn_u16(vcleq_u16(x, vld1q_u16(b->low + c))), w)) << c;
+    }
+#endif
+    for (; c < b->channels; c++) {
+        set |= (uint64_t)(frame[c] >= b->high[c]) << c;
+        reset |= (uint64_t)(frame[c] <= b->low[c]) << c;
+    }
+
+    /* Channels are independent: no carry chain across bits. */
+    b->state = set | (b->state & ~reset);
+    return b->state;
+}
+
+uint64_t schmitt_bank_update(SchmittBank *b, const uint16_t *frame)
+{
+    if (!b) return 0u;
+    if (!frame) return b->state;
+    return _schmitt_bank_frame(b, frame);
+}
+
+size_t schmitt_bank_process(SchmittBank *b, const uint16_t *frames, size_t nframes,
+                            uint64_t *words)
+{
+    if (!b || !frames || !words) return 0u;
+    for (size_t f = 0; f < nframes; f++)
+        words[f] = _schmitt_bank_frame(b, frames + f * b->channels);
+    return nframes;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file    schmitt.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Hysteresis comparators turning ADC samples into logic levels.
+ * @license MIT
+ *
+ * @details
+ * A Schmitt trigger goes high when a sample reaches the high threshold,
+ * low when it falls to the low threshold, and keeps its level in between:
+ * - sample >= high -> 1,
+ * - sample <= low  -> 0,
+ * - otherwise      -> previous level.
+ *
+ * The buffer calls classify a whole DMA buffer in one pass and write the
+ * levels straight in the format the detectors consume (bytes for
+ * `edge_update_buffer()` / `debounce_update()`, packed bits for
+ * `edge_update_packed()` / `debounce_update_packed()`), so no intermediate
+ * buffer is needed. 64 samples at a time are compared into "set" and
+ * "reset" masks (SSE2 / NEON, scalar elsewhere), and the hysteresis is
+ * resolved for all 64 with one addition: the hold state ripples through
+ * the mask like a carry.
+ *
+ * SchmittBank handles up to 64 channels of an interleaved multi-channel
+ * ADC buffer with per-channel thresholds and produces one port word per
+ * frame (bit c = channel c), ready for `edge_array_update_word()`,
+ * `edge_bank64_update()` or `debounce_port_update()`.
+ *
+ * Typical usage:
+ * @code
+ * Schmitt vin;
+ * EdgeDetector vin_edge;
+ * uint8_t bits[ADC_BUF_LEN / 8];
+ * schmitt_init(&vin, 1200, 2800, 0);
+ * edge_init(&vin_edge, 0);
+ * ...
+ * schmitt_process_packed(&vin, adc_buf, ADC_BUF_LEN, bits);
+ * edge_update_packed(&vin_edge, bits, ADC_BUF_LEN, 0, 0);
+ * @endcode
+ *
+ * Define SCHMITT_SIMD_DISABLE to force the scalar comparisons.
+ */
+
+#ifndef SCHMITT_H
+#define SCHMITT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Largest number of channels of a SchmittBank. */
+#define SCHMITT_BANK_MAX_CHANNELS 64u
+
+/**
+ * @struct Schmitt
+ * @brief Hysteresis comparator of one channel.
+ *
+ * @var Schmitt::low
+ *      Samples at or below this value switch the output low.
+ * @var Schmitt::high
+ *      Samples at or above this value switch the output high.
+ * @var Schmitt::state
+ *      Current output level (0 or 1).
+ */
+typedef struct {
+    uint16_t low;
+    uint16_t high;
+    uint8_t state;
+} Schmitt;
+
+/**
+ * @struct SchmittBank
+ * @brief Hysteresis comparators of up to 64 interleaved channels.
+ *
+ * @var SchmittBank::low
+ *      Per-channel low thresholds (`channels` entries, caller-owned, may be const/ROM).
+ * @var SchmittBank::high
+ *      Per-channel high thresholds (`channels` entries, caller-owned).
+ * @var SchmittBank::state
+ *      Current output levels, bit c = channel c.
+ * @var SchmittBank::channels
+ *      Number of channels per frame (1..64).
+ */
+typedef struct {
+    const uint16_t *low;
+    const uint16_t *high;
+    uint64_t state;
+    uint8_t channels;
+} SchmittBank;
+
+/**
+ * @brief Initializes a comparator.
+ * @param s Pointer to the Schmitt instance.
+ * @param low Low threshold.
+ * @param high High threshold, must be greater than `low`.
+ * @param initial_state Initial output level (0 or 1).
+ * @return 1 on success, 0 if the thresholds are not ordered.
+ */
+uint8_t schmitt_init(Schmitt *s, uint16_t low, uint16_t high, uint8_t initial_state);
+
+/**
+ * @brief Processes one sample.
+ * @param s Pointer to the Schmitt instance.
+ * @param sample ADC sample.
+ * @return Output level (0 or 1).
+ */
+uint8_t schmitt_update(Schmitt *s, uint16_t sample);
+
+/**
+ * @brief Processes a buffer into one level byte per sample.
+ * @param s Pointer to the Schmitt instance.
+ * @param samples ADC samples, oldest first.
+ * @param n Number of samples.
+ * @param levels Output, `n` bytes of 0/1.
+ * @return Output level after the last sample.
+ */
+uint8_t schmitt_process(Schmitt *s, const uint16_t *samples, size_t n, uint8_t *levels);
+
+/**
+ * @brief Processes a buffer into packed levels (LSB-first).
+ * @param s Pointer to the Schmitt instance.
+ * @param samples ADC samples, oldest first.
+ * @param n Number of samples.
+ * @param bits Output, (n + 7) / 8 bytes starting at bit 0; unused bits of
+ *             the last byte are cleared.
+ * @return Output level after the last sample.
+ *
+ * @details
+ * Consecutive calls with `n` a multiple of 8 produce one continuous stream.
+ */
+uint8_t schmitt_process_packed(Schmitt *s, const uint16_t *samples, size_t n, uint8_t *bits);
+
+/**
+ * @brief Initializes a multi-channel bank.
+ * @param b Pointer to the SchmittBank instance.
+ * @param low Per-channel low thresholds (kept by reference).
+ * @param high Per-channel high thresholds (kept by reference).
+ * @param channels Number of channels per frame (1..64).
+ * @param initial_state Initial output levels, bit c = channel c.
+ * @return 1 on success, 0 on invalid arguments or unordered thresholds.
+ */
+uint8_t schmitt_bank_init(SchmittBank *b, const uint16_t *low, const uint16_t *high,
+                          uint8_t channels, uint64_t initial_state);
+
+/**
+ * @brief Processes one frame of `channels` interleaved samples.
+ * @param b Pointer to the SchmittBank instance.
+ * @param frame Samples of all channels at one time step.
+ * @return Output levels, bit c = channel c.
+ */
+uint64_t schmitt_bank_update(SchmittBank *b, const uint16_t *frame);
+
+/**
+ * @brief Processes consecutive frames into one port word per frame.
+ * @param b Pointer to the SchmittBank instance.
+ * @param frames `nframes * channels` interleaved samples.
+ * @param nframes Number of frames.
+ * @param words Output, `nframes` port words.
+ * @return Number of frames processed.
+ */
+size_t schmitt_bank_process(SchmittBank *b, const uint16_t *frames, size_t nframes,
+                            uint64_t *words);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SCHMITT_H */
@@ -0,0 +1,31 @@
+/**
+ * @file    diff_fuzz.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   libFuzzer entry point of the differential harness.
+ * @license MIT
+ *
+ * @details
+ * Built with `-DCLIB_FUZZ=ON` (Clang). The input bytes are the case
+ * parameters followed by the packed sample stream, see
+ * `diff_case_from_bytes()`; any divergence from the reference models aborts
+ * so the fuzzer keeps the input:
+ * @code
+ * ./clib_diff_fuzz -max_len=4096 corpus/
+ * @endcode
+ */
+
+#include <stdlib.h>
+
+#include "diff_harness.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    DiffCase c;
+    diff_case_from_bytes(&c, data, size);
+    if (diff_run_case(&c)) abort();
+    return 0;
+}
@@ -0,0 +1,1344 @@
+/**
+ * @file    diff_harness.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the differential harness.
+ * @license MIT
+ *
+ * @details
+ * Every check builds fresh instances, replays the case and compares each
+ * step with the models. Bulk calls are fed in chunks of random length so
+ * that state carried across calls (and across 64-sample words inside a
+ * call) is exercised at arbitrary offsets. Inputs of the byte paths use
+ * arbitrary non-zero values for a high level, as the API allows.
+ */
+
+#include "diff_harness.h"
+#include "diff_reference.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "edge_detector.h"
+#include "edge_event_queue.h"
+#include "edge_timing.h"
+#include "edge_history.h"
+#include "edge_simd.h"
+#include "edge_glitch.h"
+#include "edge_bank.h"
+#include "edge_array.h"
+#include "edge_table.h"
+#include "debounce.h"
+#include "debounce_port.h"
+#include "debounce_wheel.h"
+#include "debounce_table.h"
+#include "debounced_edge.h"
+#include "quadrature.h"
+#include "schmitt.h"
+#if defined(CLIB_DIFF_ENGINE)
+#include "shard_engine.h"
+#endif
+
+/** @brief Mismatches described on stderr per process. */
+#define DIFF_REPORT_LIMIT 20u
+
+/** @brief Most channels of the array and table paths (3 words). */
+#define DIFF_MAX_CHANNELS 192u
+
+static uint32_t diff_failures;
+static uint32_t diff_reported;
+
+#define DIFF_CHECK(path, index, expected, actual)                              \
+    do {                                                                       \
+        uint64_t e_ = (uint64_t)(expected), a_ = (uint64_t)(actual);           \
+        if (e_ != a_) diff_report((path), (index), e_, a_);                    \
+    } while (0)
+
+void diff_report(const char *path, size_t index, uint64_t expected, uint64_t actual)
+{
+    diff_failures++;
+    if (diff_reported++ < DIFF_REPORT_LIMIT)
+        fprintf(stderr, "mismatch: %s at %lu: expected %llu, got %llu\n", path,
+                (unsigned long)index, (unsigned long long)expected, (unsigned long long)actual);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Case preparation                                                         */
+/* ------------------------------------------------------------------------ */
+
+typedef struct {
+    uint32_t state;
+} DiffRng;
+
+static uint32_t diff_rng(DiffRng *r)
+{
+    uint32_t x = r->state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return r->state = x;
+}
+
+static void diff_rng_seed(DiffRng *r, uint32_t seed, uint32_t stream)
+{
+    r->state = (seed ^ (stream * 0x9E3779B9u)) | 1u;
+    diff_rng(r);
+}
+
+/* Chunk length for the bulk calls, mostly short, sometimes long. */
+static size_t diff_chunk(DiffRng *r, size_t left)
+{
+    uint32_t v = diff_rng(r);
+    size_t len = (v & 7u) ? 1u + (v >> 8) % 200u : 1u + (v >> 8) % 3000u;
+    return len < left ? len : left;
+}
+
+/** @brief Expanded view of a case shared by the checks. */
+typedef struct {
+    size_t n;
+    const uint8_t *bits;
+    uint8_t *sample;        /* 0 / 1 */
+    uint8_t *raw;           /* 0 / arbitrary non-zero */
+    uint32_t *ts;           /* strictly increasing, may wrap */
+    uint32_t t0;            /* tick of the initialization */
+    uint8_t *ref_type;      /* reference EdgeType per sample */
+    size_t *ref_edges;      /* sample index of each reference edge */
+    size_t nedges;
+    uint8_t *packed;        /* scratch for re-packed chunks */
+    size_t *idx;            /* scratch for edge indices */
+} DiffStream;
+
+static uint8_t diff_bit(const uint8_t *bits, size_t i)
+{
+    return (uint8_t)((bits[i / 8u] >> (i % 8u)) & 1u);
+}
+
+/* Copies samples [start, start + len) to the start of `out`. */
+static void diff_repack(const uint8_t *bits, size_t start, size_t len, uint8_t *out)
+{
+    memset(out, 0, (len + 7u) / 8u);
+    for (size_t i = 0; i < len; i++)
+        out[i / 8u] |= (uint8_t)(diff_bit(bits, start + i) << (i % 8u));
+}
+
+static uint64_t diff_word(const uint8_t *bits, size_t word)
+{
+    uint64_t w = 0u;
+    for (unsigned b = 0; b < 8u; b++)
+        w |= (uint64_t)bits[word * 8u + b] << (8u * b);
+    return w;
+}
+
+static int diff_stream_init(DiffStream *s, const DiffCase *c)
+{
+    size_t n = c->nbits < DIFF_MAX_SAMPLES ? c->nbits : DIFF_MAX_SAMPLES;
+    DiffRng r;
+    RefEdge ref;
+
+    memset(s, 0, sizeof(*s));
+    s->n = n;
+    s->bits = c->bits;
+    s->sample = malloc(n + 1u);
+    s->raw = malloc(n + 1u);
+    s->ts = malloc((n + 1u) * sizeof(*s->ts));
+    s->ref_type = malloc(n + 1u);
+    s->ref_edges = malloc((n + 1u) * sizeof(*s->ref_edges));
+    s->packed = malloc(n / 8u + 9u);
+    s->idx = malloc((n + 1u) * sizeof(*s->idx));
+    if (!s->sample || !s->raw || !s->ts || !s->ref_type || !s->ref_edges || !s->packed || !s->idx)
+        return 0;
+
+    /* Start close to the 32-bit wrap now and then */
+    diff_rng_seed(&r, c->seed, 1u);
+    s->t0 = (c->seed & 1u) ? 0xFFFFFF00u + (diff_rng(&r) & 0x7Fu) : diff_rng(&r) >> 4;
+    uint32_t now = s->t0;
+    ref_edge_init(&ref, c->initial);
+    for (size_t i = 0; i < n; i++) {
+        uint32_t v = diff_rng(&r);
+        uint8_t bit = diff_bit(c->bits, i);
+        s->sample[i] = bit;
+        s->raw[i] = bit ? (uint8_t)(1u + (v & 0xFEu)) : 0u;
+        now += (v >> 28) ? 1u + ((v >> 8) & 3u) : 1u + ((v >> 8) & 0x3FFFu);
+        s->ts[i] = now;
+        s->ref_type[i] = (uint8_t)ref_edge_update(&ref, bit);
+        if (s->ref_type[i] != REF_NONE) s->ref_edges[s->nedges++] = i;
+    }
+    return 1;
+}
+
+static void diff_stream_free(DiffStream *s)
+{
+    free(s->sample);
+    free(s->raw);
+    free(s->ts);
+    free(s->ref_type);
+    free(s->ref_edges);
+    free(s->packed);
+    free(s->idx);
+}
+
+/** @brief Callback log shared by the edge paths. */
+typedef struct {
+    uint32_t *entries;
+    size_t count;
+    size_t capacity;
+} DiffLog;
+
+static void diff_log_edge(void *ctx, EdgeType type, uint32_t id)
+{
+    DiffLog *log = (DiffLog *)ctx;
+    if (log->count < log->capacity)
+        log->entries[log->count] = (id << 2) | (uint32_t)type;
+    log->count++;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Single signal edge paths                                                 */
+/* ------------------------------------------------------------------------ */
+
+static void diff_check_edge_scalar(const DiffCase *c, const DiffStream *s)
+{
+    EdgeDetector plain, both, hooked;
+    EdgeHooks hooks, both_hooks;
+    EdgeEventQueue queue, both_queue;
+    EdgeEvent events[64], both_events[64];
+    EdgeEvent ev;
+    EdgeTiming timing;
+    RefTiming r_timing;
+    EdgeHistory history;
+    DiffLog log = { 0, 0, 0 };
+    uint32_t history_cap = (uint32_t)(s->n * EDGE_HISTORY_MAX_RECORD + 1u);
+    uint8_t *history_buf = malloc(history_cap);
+    log.entries = malloc((s->nedges + 1u) * sizeof(*log.entries));
+    log.capacity = s->nedges + 1u;
+    if (!history_buf || !log.entries) {
+        diff_report("edge: out of memory", 0, 0, 1);
+        free(history_buf);
+        free(log.entries);
+        return;
+    }
+
+    edge_init(&plain, c->initial);
+    edge_init(&both, c->initial);
+    edge_attach_hooks(&both, &both_hooks);
+    edge_queue_init(&both_queue, both_events, 64u);
+    edge_attach_queue(&both, &both_queue, 5u);
+    edge_init(&hooked, c->initial);
+    edge_attach_hooks(&hooked, &hooks);
+    edge_set_callback(&hooked, diff_log_edge, &log, 7u);
+    edge_queue_init(&queue, events, 64u);
+    edge_attach_queue(&hooked, &queue, 9u);
+    edge_timing_init(&timing, 2u);
+    edge_attach_timing(&hooked, &timing);
+    ref_timing_init(&r_timing, 2u);
+    edge_history_init(&history, history_buf, history_cap, s->t0);
+    edge_attach_history(&hooked, &history);
+
+    for (size_t i = 0; i < s->n; i++) {
+        DIFF_CHECK("edge_update", i, s->ref_type[i], edge_update(&plain, s->raw[i]));
+        DIFF_CHECK("edge_both", i, s->ref_type[i] != REF_NONE, edge_both(&both, s->raw[i]));
+        DIFF_CHECK("edge_update_at", i, s->ref_type[i], edge_update_at(&hooked, s->raw[i], s->ts[i]));
+        if (s->ref_type[i] != REF_NONE) {
+            DIFF_CHECK("edge queue: event", i, 1u, edge_queue_pop(&queue, &ev));
+            DIFF_CHECK("edge queue: type", i, s->ref_type[i], ev.type);
+            DIFF_CHECK("edge queue: timestamp", i, s->ts[i], ev.timestamp);
+            DIFF_CHECK("edge queue: id", i, 9u, ev.signal_id);
+            ref_timing_edge(&r_timing, s->ref_type[i], s->ts[i]);
+            DIFF_CHECK("edge timing: high", i, r_timing.high, edge_timing_high(&timing));
+            DIFF_CHECK("edge timing: low", i, r_timing.low, edge_timing_low(&timing));
+            DIFF_CHECK("edge timing: period", i, r_timing.period, edge_timing_period(&timing));
+        }
+        DIFF_CHECK("edge queue: extra event", i, 0u, edge_queue_count(&queue));
+        if (s->ref_type[i] != REF_NONE) {
+            /* Untimed calls are stamped with the sample clock */
+            DIFF_CHECK("edge queue (sample clock): event", i, 1u, edge_queue_pop(&both_queue, &ev));
+            DIFF_CHECK("edge queue (sample clock): timestamp", i, i, ev.timestamp);
+        }
+    }
+
+    uint64_t rises = 0u, falls = 0u;
+    for (size_t e = 0; e < s->nedges; e++) {
+        if (s->ref_type[s->ref_edges[e]] == REF_RISING) rises++;
+        else falls++;
+    }
+    DIFF_CHECK("edge_update: rise_count", s->n, rises, edge_get_rise_count(&plain));
+    DIFF_CHECK("edge_update: fall_count", s->n, falls, edge_get_fall_count(&plain));
+    DIFF_CHECK("edge_update_at: rise_count", s->n, rises, edge_get_rise_count(&hooked));
+    DIFF_CHECK("edge_update_at: fall_count", s->n, falls, edge_get_fall_count(&hooked));
+
+    DIFF_CHECK("edge callback: count", s->n, s->nedges, log.count);
+    for (size_t e = 0; e < s->nedges && e < log.count; e++)
+        DIFF_CHECK("edge callback", s->ref_edges[e], (7u << 2) | s->ref_type[s->ref_edges[e]], log.entries[e]);
+
+    /* A stale tail (producer refilled since) reads as full, never more */
+    EdgeEventQueue stale = queue;
+    stale.head = stale.tail + stale.mask + 1u + (c->seed & 0xFFu);
+    DIFF_CHECK("edge_queue_count: stale tail", s->n, stale.mask + 1u, edge_queue_count(&stale));
+
+    EdgeHistoryIter it;
+    uint8_t level;
+    uint32_t ts;
+    size_t e = 0;
+    edge_history_iter_init(&it, &history);
+    while (edge_history_next(&it, &level, &ts) && e < s->nedges) {
+        size_t i = s->ref_edges[e++];
+        DIFF_CHECK("edge history: level", i, s->ref_type[i] == REF_RISING, level);
+        DIFF_CHECK("edge history: timestamp", i, s->ts[i], ts);
+    }
+    DIFF_CHECK("edge history: edges", s->n, s->nedges, e);
+
+    free(history_buf);
+    free(log.entries);
+}
+
+/* Drains the events of samples before `end` and checks them against the
+ * reference edges; sample i must be stamped base_ts + i. */
+static size_t diff_check_queue(const char *path, const DiffStream *s, EdgeEventQueue *q,
+                               size_t edge, size_t end, uint32_t base_ts)
+{
+    EdgeEvent ev;
+    size_t expected = 0;
+    while (edge + expected < s->nedges && s->ref_edges[edge + expected] < end)
+        expected++;
+    DIFF_CHECK(path, end, expected, edge_queue_count(q));
+    for (size_t k = 0; k < expected && edge_queue_pop(q, &ev); k++) {
+        size_t i = s->ref_edges[edge + k];
+        DIFF_CHECK(path, i, s->ref_type[i], ev.type);
+        DIFF_CHECK(path, i, base_ts + (uint32_t)i, ev.timestamp);
+    }
+    while (edge_queue_pop(q, &ev)) {}
+    return edge + expected;
+}
+
+/* Decodes a history fed with base_ts + i per sample and checks every edge
+ * and the encoded size (one LEB128 varint per gap). */
+static void diff_check_history(const char *path, const DiffStream *s, const EdgeHistory *h,
+                               uint32_t base_ts)
+{
+    EdgeHistoryIter it;
+    uint8_t level;
+    uint32_t ts, prev = base_ts;
+    uint64_t bytes = 0u;
+    size_t e = 0;
+
+    edge_history_iter_init(&it, h);
+    while (edge_history_next(&it, &level, &ts) && e < s->nedges) {
+        size_t i = s->ref_edges[e++];
+        DIFF_CHECK(path, i, s->ref_type[i] == REF_RISING, level);
+        DIFF_CHECK(path, i, base_ts + (uint32_t)i, ts);
+    }
+    DIFF_CHECK(path, s->n, s->nedges, e);
+    for (e = 0; e < s->nedges; e++) {
+        uint32_t at = base_ts + (uint32_t)s->ref_edges[e];
+        uint32_t gap = at - prev;
+        do { bytes++; gap >>= 7; } while (gap);
+        prev = at;
+    }
+    DIFF_CHECK(path, s->n, bytes, edge_history_bytes(h));
+}
+
+/* Checks the indices returned by one bulk call against the reference edges. */
+static size_t diff_check_indices(const char *path, const DiffStream *s, size_t start, size_t len,
+                                 size_t edge, size_t found, size_t stored)
+{
+    size_t expected = 0;
+    while (edge + expected < s->nedges && s->ref_edges[edge + expected] < start + len)
+        expected++;
+    DIFF_CHECK(path, start, expected, found);
+    for (size_t k = 0; k < stored && k < expected; k++)
+        DIFF_CHECK(path, s->ref_edges[edge + k], s->ref_edges[edge + k], start + s->idx[k]);
+    return edge + expected;
+}
+
+static void diff_check_edge_bulk(const DiffCase *c, const DiffStream *s)
+{
+    EdgeDetector buf_idx, buf_fast, buf_cb, pk_idx, pk_fast, buf_q, pk_q;
+    EdgeHooks cb_hooks, buf_hooks, pk_hooks;
+    EdgeEventQueue buf_queue, pk_queue;
+    EdgeTiming buf_timing, pk_timing;
+    EdgeHistory buf_history, pk_history;
+    RefTiming r_buf_timing, r_pk_timing;
+    DiffLog log = { 0, 0, 0 };
+    DiffRng r;
+    size_t e_buf = 0, e_pk = 0, e_bq = 0, e_pq = 0, e_tm = 0, total_fast = 0, total_pk = 0;
+    /* Long chunks hold up to 3000 samples */
+    EdgeEvent *buf_events = malloc(4096u * sizeof(*buf_events));
+    EdgeEvent *pk_events = malloc(4096u * sizeof(*pk_events));
+    uint32_t history_cap = (uint32_t)(s->n * EDGE_HISTORY_MAX_RECORD + 1u);
+    uint8_t *buf_log = malloc(history_cap);
+    uint8_t *pk_log = malloc(history_cap);
+
+    log.entries = malloc((s->nedges + 1u) * sizeof(*log.entries));
+    log.capacity = s->nedges + 1u;
+    if (!log.entries || !buf_events || !pk_events || !buf_log || !pk_log) {
+        diff_report("edge bulk: out of memory", 0, 0, 1);
+        goto done;
+    }
+
+    edge_init(&buf_idx, c->initial);
+    edge_init(&buf_fast, c->initial);
+    edge_init(&buf_cb, c->initial);
+    edge_init(&pk_idx, c->initial);
+    edge_init(&pk_fast, c->initial);
+    edge_attach_hooks(&buf_cb, &cb_hooks);
+    edge_set_callback(&buf_cb, diff_log_edge, &log, 3u);
+    edge_init(&buf_q, c->initial);
+    edge_init(&pk_q, c->initial);
+    edge_attach_hooks(&buf_q, &buf_hooks);
+    edge_attach_hooks(&pk_q, &pk_hooks);
+    edge_queue_init(&buf_queue, buf_events, 4096u);
+    edge_queue_init(&pk_queue, pk_events, 4096u);
+    edge_attach_queue(&buf_q, &buf_queue, 1u);
+    edge_attach_queue(&pk_q, &pk_queue, 2u);
+    edge_timing_init(&buf_timing, 0u);
+    edge_timing_init(&pk_timing, 3u);
+    edge_attach_timing(&buf_q, &buf_timing);
+    edge_attach_timing(&pk_q, &pk_timing);
+    ref_timing_init(&r_buf_timing, 0u);
+    ref_timing_init(&r_pk_timing, 3u);
+    edge_history_init(&buf_history, buf_log, history_cap, s->t0);
+    edge_history_init(&pk_history, pk_log, history_cap, s->t0);
+    edge_attach_history(&buf_q, &buf_history);
+    edge_attach_history(&pk_q, &pk_history);
+
+    diff_rng_seed(&r, c->seed, 2u);
+    for (size_t pos = 0, k = 0; pos < s->n; k++) {
+        size_t len = diff_chunk(&r, s->n - pos);
+        /* Every other chunk gets a short index array */
+        size_t cap = (k & 1u) ? len / 3u : len;
+        size_t found;
+
+        found = edge_update_buffer(&buf_idx, s->raw + pos, len, s->idx, cap);
+        e_buf = diff_check_indices("edge_update_buffer", s, pos, len, e_buf, found, cap);
+        total_fast += edge_update_buffer(&buf_fast, s->raw + pos, len, 0, 0);
+        edge_update_buffer(&buf_cb, s->raw + pos, len, 0, 0);
+
+        diff_repack(s->bits, pos, len, s->packed);
+        found = edge_update_packed(&pk_idx, s->packed, len, s->idx, cap);
+        e_pk = diff_check_indices("edge_update_packed", s, pos, len, e_pk, found, cap);
+        total_pk += edge_update_packed(&pk_fast, s->packed, len, 0, 0);
+
+        /* Timestamps continue across calls, with or without an explicit base */
+        if (k == 0 || (diff_rng(&r) & 1u))
+            edge_update_buffer_at(&buf_q, s->raw + pos, len, 0, 0, s->t0 + (uint32_t)pos);
+        else
+            edge_update_buffer(&buf_q, s->raw + pos, len, 0, 0);
+        e_bq = diff_check_queue("edge_update_buffer_at: queue", s, &buf_queue, e_bq, pos + len, s->t0);
+        if (k == 0 || (diff_rng(&r) & 1u))
+            edge_update_packed_at(&pk_q, s->packed, len, 0, 0, s->t0 + (uint32_t)pos);
+        else
+            edge_update_packed(&pk_q, s->packed, len, 0, 0);
+        e_pq = diff_check_queue("edge_update_packed_at: queue", s, &pk_queue, e_pq, pos + len, s->t0);
+
+        /* Intervals across chunk boundaries use the same time base */
+        for (; e_tm < s->nedges && s->ref_edges[e_tm] < pos + len; e_tm++) {
+            size_t i = s->ref_edges[e_tm];
+            ref_timing_edge(&r_buf_timing, s->ref_type[i], s->t0 + (uint32_t)i);
+            ref_timing_edge(&r_pk_timing, s->ref_type[i], s->t0 + (uint32_t)i);
+        }
+        DIFF_CHECK("edge_update_buffer_at: timing high", pos + len, r_buf_timing.high, edge_timing_high(&buf_timing));
+        DIFF_CHECK("edge_update_buffer_at: timing low", pos + len, r_buf_timing.low, edge_timing_low(&buf_timing));
+        DIFF_CHECK("edge_update_buffer_at: timing period", pos + len, r_buf_timing.period, edge_timing_period(&buf_timing));
+        DIFF_CHECK("edge_update_packed_at: timing high", pos + len, r_pk_timing.high, edge_timing_high(&pk_timing));
+        DIFF_CHECK("edge_update_packed_at: timing low", pos + len, r_pk_timing.low, edge_timing_low(&pk_timing));
+        DIFF_CHECK("edge_update_packed_at: timing period", pos + len, r_pk_timing.period, edge_timing_period(&pk_timing));
+        pos += len;
+    }
+
+    DIFF_CHECK("edge_update_buffer (SIMD): edges", s->n, s->nedges, total_fast);
+    DIFF_CHECK("edge_update_packed (no indices): edges", s->n, s->nedges, total_pk);
+
+    EdgeDetector *dets[] = { &buf_idx, &buf_fast, &buf_cb, &pk_idx, &pk_fast };
+    const char *names[] = { "edge_update_buffer", "edge_update_buffer (SIMD)",
+                            "edge_update_buffer (callback)", "edge_update_packed",
+                            "edge_update_packed (no indices)" };
+    RefEdge ref;
+    ref_edge_init(&ref, c->initial);
+    for (size_t i = 0; i < s->n; i++) ref_edge_update(&ref, s->sample[i]);
+    for (size_t d = 0; d < sizeof(dets) / sizeof(dets[0]); d++) {
+        DIFF_CHECK(names[d], s->n, ref.level, dets[d]->prev);
+        DIFF_CHECK(names[d], s->n, ref.rises, edge_get_rise_count(dets[d]));
+        DIFF_CHECK(names[d], s->n, ref.falls, edge_get_fall_count(dets[d]));
+    }
+
+    DIFF_CHECK("edge_update_buffer (callback): count", s->n, s->nedges, log.count);
+    for (size_t e = 0; e < s->nedges && e < log.count; e++)
+        DIFF_CHECK("edge_update_buffer (callback)", s->ref_edges[e],
+                   (3u << 2) | s->ref_type[s->ref_edges[e]], log.entries[e]);
+
+    /* Transition kernels, also from unaligned starts */
+    for (size_t start = 0; start < 40u && start < s->n; start += 1u + start) {
+        uint8_t prev = start ? s->sample[start - 1u] : c->initial;
+        size_t expected = 0;
+        for (size_t e = 0; e < s->nedges; e++)
+            if (s->ref_edges[e] >= start) expected++;
+        DIFF_CHECK("edge_simd_count_transitions", start, expected,
+                   edge_simd_count_transitions(prev, s->raw + start, s->n - start));
+        DIFF_CHECK("edge_simd_count_transitions_scalar", start, expected,
+                   edge_simd_count_transitions_scalar(prev, s->raw + start, s->n - start));
+    }
+
+    DIFF_CHECK("edge_update_buffer_at: dropped", s->n, 0u, edge_queue_dropped(&buf_queue));
+    DIFF_CHECK("edge_update_packed_at: dropped", s->n, 0u, edge_queue_dropped(&pk_queue));
+    diff_check_history("edge_update_buffer_at: history", s, &buf_history, s->t0);
+    diff_check_history("edge_update_packed_at: history", s, &pk_history, s->t0);
+
+done:
+    free(log.entries);
+    free(buf_events);
+    free(pk_events);
+    free(buf_log);
+    free(pk_log);
+}
+
+static void diff_check_glitch(const DiffCase *c, const DiffStream *s)
+{
+    EdgeDetector d_step, d_packed, d_at;
+    EdgeGlitch g_step, g_packed, g_at;
+    RefGlitch r_step, r_at;
+    DiffRng r;
+    size_t *edges = malloc((s->n + 1u) * sizeof(*edges));
+    size_t nedges = 0, e = 0;
+    if (!edges) {
+        diff_report("edge_glitch: out of memory", 0, 0, 1);
+        return;
+    }
+
+    edge_init(&d_step, c->initial);
+    edge_init(&d_packed, c->initial);
+    edge_init(&d_at, c->initial);
+    edge_glitch_init(&g_step, &d_step, c->glitch_width);
+    edge_glitch_init(&g_packed, &d_packed, c->glitch_width);
+    edge_glitch_init(&g_at, &d_at, c->glitch_width);
+    ref_glitch_init(&r_step, c->initial, c->glitch_width);
+    ref_glitch_init(&r_at, c->initial, c->glitch_width);
+
+    for (size_t i = 0; i < s->n; i++) {
+        int expected = ref_glitch_update(&r_step, s->sample[i]);
+        if (expected != REF_NONE) edges[nedges++] = i;
+        DIFF_CHECK("edge_glitch_update", i, expected, edge_glitch_update(&g_step, s->raw[i]));
+        DIFF_CHECK("edge_glitch_update_at", i, ref_glitch_update_at(&r_at, s->sample[i], s->ts[i]),
+                   edge_glitch_update_at(&g_at, s->raw[i], s->ts[i]));
+    }
+
+    diff_rng_seed(&r, c->seed, 3u);
+    for (size_t pos = 0; pos < s->n;) {
+        size_t len = diff_chunk(&r, s->n - pos);
+        size_t expected = 0;
+        diff_repack(s->bits, pos, len, s->packed);
+        size_t found = edge_glitch_update_packed(&g_packed, s->packed, len, s->idx, len);
+        while (e + expected < nedges && edges[e + expected] < pos + len) expected++;
+        DIFF_CHECK("edge_glitch_update_packed: edges", pos, expected, found);
+        for (size_t k = 0; k < found && k < expected; k++)
+            DIFF_CHECK("edge_glitch_update_packed", edges[e + k], edges[e + k], pos + s->idx[k]);
+        e += expected;
+        pos += len;
+    }
+
+    DIFF_CHECK("edge_glitch_update: rise_count", s->n, r_step.out.rises, edge_get_rise_count(&d_step));
+    DIFF_CHECK("edge_glitch_update: fall_count", s->n, r_step.out.falls, edge_get_fall_count(&d_step));
+    DIFF_CHECK("edge_glitch_update_packed: rise_count", s->n, r_step.out.rises, edge_get_rise_count(&d_packed));
+    DIFF_CHECK("edge_glitch_update_packed: fall_count", s->n, r_step.out.falls, edge_get_fall_count(&d_packed));
+    DIFF_CHECK("edge_glitch_update_at: rise_count", s->n, r_at.out.rises, edge_get_rise_count(&d_at));
+
+    free(edges);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Word-parallel edge paths                                                 */
+/* ------------------------------------------------------------------------ */
+
+/* Brute-force model of an EdgeRate: plain per-channel counts per window. */
+typedef struct {
+    uint32_t current[DIFF_MAX_CHANNELS];
+    uint32_t last[DIFF_MAX_CHANNELS];
+    uint32_t window;
+    uint32_t window_start;
+    uint64_t edges;
+    uint64_t last_edges;
+} DiffRate;
+
+static uint32_t diff_rate_advance(DiffRate *m, uint32_t channels, uint32_t now)
+{
+    uint32_t elapsed = now - m->window_start;
+    if (elapsed < m->window) return 0u;
+    uint32_t closed = elapsed / m->window;
+    m->window_start += closed * m->window;
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        m->last[ch] = (closed == 1u) ? m->current[ch] : 0u;
+        m->current[ch] = 0u;
+    }
+    m->last_edges = (closed == 1u) ? m->edges : 0u;
+    m->edges = 0u;
+    return closed;
+}
+
+/* Histogram and top-K of the last window against the brute-force counts. */
+static void diff_check_rate_window(const DiffRate *m, const EdgeRate *r, uint32_t channels,
+                                   uint32_t k, size_t step)
+{
+    uint32_t hist[EDGE_RATE_BUCKETS], expected[EDGE_RATE_BUCKETS] = { 0 };
+    uint32_t active = 0u;
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        uint32_t n = m->last[ch];
+        uint32_t b = 0u;
+        while (n >> b) b++;     /* 0 for no edge, else 1 + msb */
+        expected[b]++;
+        if (n) active++;
+    }
+    DIFF_CHECK("edge_rate_histogram: active", step, active, edge_rate_histogram(r, hist));
+    for (uint32_t b = 0; b < EDGE_RATE_BUCKETS; b++)
+        DIFF_CHECK("edge_rate_histogram", step * EDGE_RATE_BUCKETS + b, expected[b], hist[b]);
+    DIFF_CHECK("edge_rate: last edges", step, m->last_edges, r->last_edges);
+
+    /* Ties at the K boundary may keep either channel: compare the counts */
+    EdgeRateTop top[8];
+    uint8_t used[DIFF_MAX_CHANNELS] = { 0 };
+    uint32_t n = edge_rate_top(r, top, 8u);
+    DIFF_CHECK("edge_rate_top: entries", step, (active < k) ? active : k, n);
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t best = 0u, best_ch = 0u;
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            if (!used[ch] && m->last[ch] > best) {
+                best = m->last[ch];
+                best_ch = ch;
+            }
+        }
+        used[best_ch] = 1u;
+        DIFF_CHECK("edge_rate_top: count", step, best, top[i].count);
+        DIFF_CHECK("edge_rate_top: channel", step, top[i].channel < channels ? m->last[top[i].channel] : 0u,
+                   top[i].count);
+        if (i > 0u)
+            DIFF_CHECK("edge_rate_top: order", step, 1u,
+                       top[i - 1u].count > top[i].count ||
+                       (top[i - 1u].count == top[i].count && top[i - 1u].channel < top[i].channel));
+    }
+}
+
+static void diff_check_edge_words(const DiffCase *c, const DiffStream *s)
+{
+    size_t nwords = s->n / 64u;
+    if (nwords < 2u) return;
+
+    /* 64 / 32 signal banks: word 0 is the initial port value */
+    EdgeBank64 b64;
+    EdgeBank32 b32;
+    RefEdge pins[64];
+    uint64_t first = diff_word(s->bits, 0);
+    edge_bank64_init(&b64, first);
+    edge_bank32_init(&b32, (uint32_t)first);
+    for (unsigned p = 0; p < 64u; p++) ref_edge_init(&pins[p], (uint8_t)((first >> p) & 1u));
+
+    for (size_t w = 1; w < nwords; w++) {
+        uint64_t port = diff_word(s->bits, w);
+        uint64_t rising = 0u, falling = 0u;
+        for (unsigned p = 0; p < 64u; p++) {
+            int t = ref_edge_update(&pins[p], (uint8_t)((port >> p) & 1u));
+            if (t == REF_RISING) rising |= (uint64_t)1u << p;
+            if (t == REF_FALLING) falling |= (uint64_t)1u << p;
+        }
+        DIFF_CHECK("edge_bank64_update", w, rising | falling, edge_bank64_update(&b64, port));
+        DIFF_CHECK("edge_bank64_rising", w, rising, edge_bank64_rising(&b64));
+        DIFF_CHECK("edge_bank64_falling", w, falling, edge_bank64_falling(&b64));
+        DIFF_CHECK("edge_bank32_update", w, (uint32_t)(rising | falling), edge_bank32_update(&b32, (uint32_t)port));
+        DIFF_CHECK("edge_bank32_rising", w, (uint32_t)rising, edge_bank32_rising(&b32));
+        DIFF_CHECK("edge_bank32_falling", w, (uint32_t)falling, edge_bank32_falling(&b32));
+    }
+
+    /* Channel arrays: the first group of words is the initial state */
+    uint32_t channels = c->channels;
+    uint32_t words = EDGE_ARRAY_WORDS(channels);
+    size_t steps = nwords / words;
+    if (steps < 2u) return;
+
+    uint64_t arr_prev[EDGE_ARRAY_WORDS(DIFF_MAX_CHANNELS)];
+    uint32_t arr_rise[DIFF_MAX_CHANNELS], arr_fall[DIFF_MAX_CHANNELS];
+    uint64_t tab_level[EDGE_TABLE_WORDS(DIFF_MAX_CHANNELS)];
+    uint32_t tab_rise[DIFF_MAX_CHANNELS], tab_fall[DIFF_MAX_CHANNELS];
+    uint64_t idle[EDGE_TABLE_WORDS(DIFF_MAX_CHANNELS)];
+    RefEdge refs[DIFF_MAX_CHANNELS];
+    uint8_t step_type[DIFF_MAX_CHANNELS];
+    uint32_t expected_log[DIFF_MAX_CHANNELS], arr_entries[DIFF_MAX_CHANNELS], tab_entries[DIFF_MAX_CHANNELS];
+    DiffLog arr_log = { arr_entries, 0, DIFF_MAX_CHANNELS };
+    DiffLog tab_log = { tab_entries, 0, DIFF_MAX_CHANNELS };
+    EdgeArray arr;
+    EdgeRate rate;
+    EdgeRateSlot rate_slots[DIFF_MAX_CHANNELS];
+    EdgeRateTop rate_top[8], rate_last_top[8];
+    DiffRate r_rate;
+    uint32_t rate_k = 1u + (c->seed >> 8) % 8u;
+
+    for (uint32_t w = 0; w < words; w++) idle[w] = diff_word(s->bits, w);
+    for (uint32_t ch = 0; ch < channels; ch++)
+        ref_edge_init(&refs[ch], (uint8_t)((idle[ch / 64u] >> (ch % 64u)) & 1u));
+
+    edge_array_init(&arr, arr_prev, arr_rise, arr_fall, channels);
+    for (uint32_t w = 0; w < words; w++) edge_array_set_word(&arr, w, idle[w]);
+    edge_array_set_callback(&arr, diff_log_edge, &arr_log);
+
+    /* Windows of a few steps on the stream's clock, wrap and gaps included */
+    memset(&r_rate, 0, sizeof(r_rate));
+    r_rate.window = 1u + (c->seed >> 4) % 48u;
+    r_rate.window_start = s->ts[0];
+    edge_rate_init(&rate, rate_slots, channels, rate_top, rate_last_top, rate_k, r_rate.window, s->ts[0]);
+    edge_array_attach_rate(&arr, &rate);
+
+    /* Zeroed state, as left by the startup code's .bss clear */
+    memset(tab_level, 0, sizeof(tab_level));
+    memset(tab_rise, 0, sizeof(tab_rise));
+    memset(tab_fall, 0, sizeof(tab_fall));
+    const EdgeTable table = { tab_level, tab_rise, tab_fall, idle, diff_log_edge, &tab_log, channels };
+
+    for (size_t step = 1; step < steps; step++) {
+        uint64_t changed[EDGE_TABLE_WORDS(DIFF_MAX_CHANNELS)] = { 0 };
+        size_t expected_count = 0;
+        arr_log.count = 0;
+        tab_log.count = 0;
+        uint32_t closed = diff_rate_advance(&r_rate, channels, s->ts[step]);
+        DIFF_CHECK("edge_rate_advance", step, closed, edge_rate_advance(&rate, s->ts[step]));
+        if (closed) diff_check_rate_window(&r_rate, &rate, channels, rate_k, step);
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            uint64_t word = diff_word(s->bits, step * words + ch / 64u);
+            int t = ref_edge_update(&refs[ch], (uint8_t)((word >> (ch % 64u)) & 1u));
+            step_type[ch] = (uint8_t)t;
+            if (t == REF_NONE) continue;
+            if (r_rate.current[ch] < UINT16_MAX) r_rate.current[ch]++;
+            r_rate.edges++;
+            changed[ch / 64u] |= (uint64_t)1u << (ch % 64u);
+            expected_log[expected_count++] = (ch << 2) | (uint32_t)t;
+        }
+
+        if (step & 1u) {
+            /* Word calls */
+            for (uint32_t w = 0; w < words; w++) {
+                uint64_t word = diff_word(s->bits, step * words + w);
+                DIFF_CHECK("edge_array_update_word", step, changed[w], edge_array_update_word(&arr, w, word));
+                DIFF_CHECK("edge_table_update_word", step, changed[w], edge_table_update_word(&table, w, word));
+            }
+        } else {
+            /* Single channel calls */
+            for (uint32_t ch = 0; ch < channels; ch++) {
+                uint64_t word = diff_word(s->bits, step * words + ch / 64u);
+                uint8_t in = (uint8_t)((word >> (ch % 64u)) & 1u);
+                EdgeType a = edge_array_update(&arr, ch, in);
+                EdgeType t = edge_table_update(&table, ch, in);
+                DIFF_CHECK("edge_array_update", step * DIFF_MAX_CHANNELS + ch, step_type[ch], a);
+                DIFF_CHECK("edge_table_update", step * DIFF_MAX_CHANNELS + ch, a, t);
+            }
+        }
+
+        DIFF_CHECK("edge_array callback: count", step, expected_count, arr_log.count);
+        DIFF_CHECK("edge_table callback: count", step, expected_count, tab_log.count);
+        for (size_t k = 0; k < expected_count && k < arr_log.count; k++)
+            DIFF_CHECK("edge_array callback", step, expected_log[k], arr_entries[k]);
+        for (size_t k = 0; k < expected_count && k < tab_log.count; k++)
+            DIFF_CHECK("edge_table callback", step, expected_log[k], tab_entries[k]);
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            DIFF_CHECK("edge_rate_current", step * DIFF_MAX_CHANNELS + ch, r_rate.current[ch], edge_rate_current(&rate, ch));
+            DIFF_CHECK("edge_rate_last", step * DIFF_MAX_CHANNELS + ch, r_rate.last[ch], edge_rate_last(&rate, ch));
+        }
+    }
+
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        DIFF_CHECK("edge_array: rise_count", ch, refs[ch].rises, edge_array_get_rise_count(&arr, ch));
+        DIFF_CHECK("edge_array: fall_count", ch, refs[ch].falls, edge_array_get_fall_count(&arr, ch));
+        DIFF_CHECK("edge_table: rise_count", ch, refs[ch].rises, edge_table_get_rise_count(&table, ch));
+        DIFF_CHECK("edge_table: fall_count", ch, refs[ch].falls, edge_table_get_fall_count(&table, ch));
+        DIFF_CHECK("edge_table_level", ch, refs[ch].level, edge_table_level(&table, ch));
+    }
+}
+
+/* ------------------------------------------------------------------------ */
+/* Debounce paths                                                           */
+/* ------------------------------------------------------------------------ */
+
+static void diff_check_debounce_scalar(const DiffCase *c, const DiffStream *s)
+{
+    Debounce plain, ticks, integ, vote, pk_plain, pk_integ, pk_vote;
+    DebouncedEdge fused;
+    DebounceWheel wheel;
+    DebounceTimer timer;
+    RefDebounce r_plain, r_ticks, r_wheel;
+    RefIntegrator r_integ;
+    RefMajority r_vote;
+    RefEdge r_fused;
+    /* Scaled by 1, 64 or 4096: timers start on level 0, 1 or 2 */
+    uint32_t wheel_settle = (c->settle ? c->settle : 1u) << (6u * (c->seed % 3u));
+    uint8_t *out_plain = malloc(s->n + 1u);
+    uint8_t *out_integ = malloc(s->n + 1u);
+    uint8_t *out_vote = malloc(s->n + 1u);
+    DiffRng r;
+    if (!out_plain || !out_integ || !out_vote) {
+        diff_report("debounce: out of memory", 0, 0, 1);
+        goto done;
+    }
+
+    debounce_init(&plain, 0, c->initial);
+    debounce_init(&pk_plain, 0, c->initial);
+    debounce_init_ticks(&ticks, c->settle, c->initial, s->t0);
+    debounce_init_integrator(&integ, c->limit, c->initial);
+    debounce_init_integrator(&pk_integ, c->limit, c->initial);
+    debounce_init_majority(&vote, c->vote_n, c->vote_m, c->initial);
+    debounce_init_majority(&pk_vote, c->vote_n, c->vote_m, c->initial);
+    debounced_edge_init_ticks(&fused, c->settle, c->initial, s->t0);
+    debounce_wheel_init(&wheel, s->t0);
+    debounce_timer_init(&timer, wheel_settle, c->initial, 0, 0);
+
+    ref_debounce_init(&r_plain, 0u, c->initial, s->t0);
+    ref_debounce_init(&r_ticks, c->settle, c->initial, s->t0);
+    ref_debounce_init(&r_wheel, wheel_settle, c->initial, s->t0);
+    ref_integrator_init(&r_integ, c->limit, c->initial);
+    ref_majority_init(&r_vote, c->vote_n, c->vote_m, c->initial);
+    ref_edge_init(&r_fused, c->initial);
+
+    for (size_t i = 0; i < s->n; i++) {
+        uint8_t in = s->sample[i];
+        uint32_t now = s->ts[i];
+
+        out_plain[i] = ref_debounce_update(&r_plain, in, now);
+        DIFF_CHECK("debounce_update", i, out_plain[i], debounce_update(&plain, s->raw[i]));
+
+        uint8_t expected = ref_debounce_update(&r_ticks, in, now);
+        DIFF_CHECK("debounce_update_at", i, expected, debounce_update_at(&ticks, s->raw[i], now));
+        DIFF_CHECK("debounced_edge_update_at", i, ref_edge_update(&r_fused, expected),
+                   debounced_edge_update_at(&fused, s->raw[i], now));
+        DIFF_CHECK("debounced_edge_output", i, expected, debounced_edge_output(&fused));
+
+        /* Input first, then the tick: a change is never confirmed at its own tick */
+        debounce_wheel_input(&wheel, &timer, in, now);
+        debounce_wheel_advance(&wheel, now);
+        DIFF_CHECK("debounce_wheel", i, ref_debounce_update(&r_wheel, in, now), timer.deb.stable_output);
+
+        out_integ[i] = ref_integrator_update(&r_integ, in);
+        DIFF_CHECK("debounce_update (integrator)", i, out_integ[i], debounce_update(&integ, s->raw[i]));
+        out_vote[i] = ref_majority_update(&r_vote, in);
+        DIFF_CHECK("debounce_update (majority)", i, out_vote[i], debounce_update(&vote, s->raw[i]));
+    }
+    DIFF_CHECK("debounced_edge: rise_count", s->n, r_fused.rises, debounced_edge_get_rise_count(&fused));
+    DIFF_CHECK("debounced_edge: fall_count", s->n, r_fused.falls, debounced_edge_get_fall_count(&fused));
+
+    diff_rng_seed(&r, c->seed, 4u);
+    for (size_t pos = 0; pos < s->n;) {
+        size_t len = diff_chunk(&r, s->n - pos);
+        size_t last = pos + len - 1u;
+        diff_repack(s->bits, pos, len, s->packed);
+        DIFF_CHECK("debounce_update_packed", last, out_plain[last], debounce_update_packed(&pk_plain, s->packed, len));
+        DIFF_CHECK("debounce_update_packed (integrator)", last, out_integ[last],
+                   debounce_update_packed(&pk_integ, s->packed, len));
+        DIFF_CHECK("debounce_update_packed (majority)", last, out_vote[last],
+                   debounce_update_packed(&pk_vote, s->packed, len));
+        pos += len;
+    }
+
+done:
+    free(out_plain);
+    free(out_integ);
+    free(out_vote);
+}
+
+static void diff_check_debounce_words(const DiffCase *c, const DiffStream *s)
+{
+    size_t nwords = s->n / 64u;
+    if (nwords < 2u) return;
+
+    /* Port debouncers: word 0 is the initial port value */
+    DebouncePort port;
+    DebouncedEdgeBank bank;
+    RefPortPin pins[64];
+    RefEdge pin_edges[64];
+    uint64_t first = diff_word(s->bits, 0);
+    debounce_port_init(&port, c->port_samples, first);
+    debounced_edge_bank_init(&bank, c->port_samples, first);
+    for (unsigned p = 0; p < 64u; p++) {
+        ref_port_pin_init(&pins[p], c->port_samples, (uint8_t)((first >> p) & 1u));
+        ref_edge_init(&pin_edges[p], (uint8_t)((first >> p) & 1u));
+    }
+
+    for (size_t w = 1; w < nwords; w++) {
+        uint64_t input = diff_word(s->bits, w);
+        uint64_t stable = 0u, rising = 0u, falling = 0u;
+        for (unsigned p = 0; p < 64u; p++) {
+            uint8_t out = ref_port_pin_update(&pins[p], (uint8_t)((input >> p) & 1u));
+            int t = ref_edge_update(&pin_edges[p], out);
+            stable |= (uint64_t)out << p;
+            if (t == REF_RISING) rising |= (uint64_t)1u << p;
+            if (t == REF_FALLING) falling |= (uint64_t)1u << p;
+        }
+        DIFF_CHECK("debounce_port_update", w, stable, debounce_port_update(&port, input));
+        DIFF_CHECK("debounced_edge_bank_update", w, rising | falling, debounced_edge_bank_update(&bank, input));
+        DIFF_CHECK("debounced_edge_bank_output", w, stable, debounced_edge_bank_output(&bank));
+        DIFF_CHECK("debounced_edge_bank_rising", w, rising, debounced_edge_bank_rising(&bank));
+        DIFF_CHECK("debounced_edge_bank_falling", w, falling, debounced_edge_bank_falling(&bank));
+    }
+
+    /* Debounce table: zeroed state, per-channel settle times */
+    uint32_t channels = c->channels;
+    uint32_t words = DEBOUNCE_TABLE_WORDS(channels);
+    size_t steps = nwords / words;
+    if (steps < 2u) return;
+
+    uint64_t raw[DEBOUNCE_TABLE_WORDS(DIFF_MAX_CHANNELS)], stable[DEBOUNCE_TABLE_WORDS(DIFF_MAX_CHANNELS)];
+    uint64_t idle[DEBOUNCE_TABLE_WORDS(DIFF_MAX_CHANNELS)];
+    uint32_t changed_at[DIFF_MAX_CHANNELS], settle[DIFF_MAX_CHANNELS];
+    RefDebounce refs[DIFF_MAX_CHANNELS];
+
+    memset(raw, 0, sizeof(raw));
+    memset(stable, 0, sizeof(stable));
+    memset(changed_at, 0, sizeof(changed_at));
+    for (uint32_t w = 0; w < words; w++) idle[w] = diff_word(s->bits, w);
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        settle[ch] = (c->settle + 7u * ch) % 40u;
+        ref_debounce_init(&refs[ch], settle[ch], (uint8_t)((idle[ch / 64u] >> (ch % 64u)) & 1u), 0u);
+    }
+    const DebounceTable table = { raw, stable, changed_at, idle, settle, 0u, channels };
+
+    for (size_t step = 1; step < steps; step++) {
+        uint32_t now = s->ts[step] - s->t0;
+        uint64_t expected[DEBOUNCE_TABLE_WORDS(DIFF_MAX_CHANNELS)] = { 0 };
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            uint64_t word = diff_word(s->bits, step * words + ch / 64u);
+            uint8_t out = ref_debounce_update(&refs[ch], (uint8_t)((word >> (ch % 64u)) & 1u), now);
+            expected[ch / 64u] |= (uint64_t)out << (ch % 64u);
+            if (!(step & 1u))
+                DIFF_CHECK("debounce_table_update_at", step * DIFF_MAX_CHANNELS + ch, out,
+                           debounce_table_update_at(&table, ch, (uint8_t)((word >> (ch % 64u)) & 1u), now));
+        }
+        for (uint32_t w = 0; w < words; w++) {
+            if (step & 1u)
+                DIFF_CHECK("debounce_table_update_word_at", step, expected[w],
+                           debounce_table_update_word_at(&table, w, diff_word(s->bits, step * words + w), now));
+        }
+    }
+    for (uint32_t ch = 0; ch < channels; ch++)
+        DIFF_CHECK("debounce_table_output", ch, refs[ch].stable, debounce_table_output(&table, ch));
+}
+
+/* ------------------------------------------------------------------------ */
+/* Quadrature decoder                                                       */
+/* ------------------------------------------------------------------------ */
+
+/* Next state (B << 1) | A of an encoder walk: mostly one step in the
+ * direction given by `forward`, sometimes a hold or an invalid jump. */
+static uint8_t diff_quadrature_walk(uint8_t state, uint8_t forward, uint32_t v)
+{
+    static const uint8_t next[2][4] = { { 2u, 0u, 3u, 1u }, { 1u, 3u, 0u, 2u } };
+    if ((v & 15u) == 0u) return (uint8_t)(state ^ 3u);
+    if ((v & 15u) == 1u) return state;
+    return next[forward][state];
+}
+
+static void diff_check_quadrature(const DiffCase *c, const DiffStream *s)
+{
+    DiffRng r;
+    diff_rng_seed(&r, c->seed, 6u);
+
+    /* Single encoder: walks along the stream (1 = forward), fed as levels
+     * (arbitrary non-zero values) or as states with garbage upper bits */
+    Quadrature q;
+    RefQuadrature ref;
+    uint8_t state = (uint8_t)((c->initial << 1) | (c->seed & 1u));
+    quadrature_init(&q, (uint8_t)(state & 1u), (uint8_t)(state >> 1));
+    ref_quadrature_init(&ref, (uint8_t)(state & 1u), (uint8_t)(state >> 1));
+    for (size_t i = 0; i < s->n; i++) {
+        uint32_t v = diff_rng(&r);
+        state = diff_quadrature_walk(state, s->sample[i], v);
+        uint8_t a = (uint8_t)(state & 1u), b = (uint8_t)(state >> 1);
+        int expected = ref_quadrature_update(&ref, a, b);
+        if (v & 0x100u)
+            DIFF_CHECK("quadrature_update", i, expected,
+                       quadrature_update(&q, a ? s->raw[i] | 1u : 0u, b ? (uint8_t)(v >> 24) | 1u : 0u));
+        else
+            DIFF_CHECK("quadrature_update_state", i, expected,
+                       quadrature_update_state(&q, (uint8_t)(state | ((v >> 24) & 0xFCu))));
+        if (i == s->n / 2u) {
+            quadrature_set_position(&q, (int32_t)v);
+            ref.position = (int32_t)v;
+        }
+    }
+    DIFF_CHECK("quadrature: position", s->n, ref.position, quadrature_position(&q));
+    DIFF_CHECK("quadrature: errors", s->n, ref.errors, quadrature_errors(&q));
+
+    /* Bank, one port read per 4 samples: independent walks or (seed bit 2)
+     * uniformly random pairs, with garbage above the pairs in use */
+    QuadratureBank bank;
+    RefQuadrature refs[QUADRATURE_BANK_MAX];
+    uint8_t encoders = (uint8_t)(1u + (c->seed >> 4) % QUADRATURE_BANK_MAX);
+    uint8_t random_pairs = (uint8_t)((c->seed >> 2) & 1u);
+    uint32_t pairs = (encoders == QUADRATURE_BANK_MAX) ? 0xFFFFFFFFu : (1u << (2u * encoders)) - 1u;
+    uint32_t port = diff_rng(&r);
+    quadrature_bank_init(&bank, encoders, port);
+    for (uint8_t e = 0; e < encoders; e++)
+        ref_quadrature_init(&refs[e], (uint8_t)((port >> (2u * e)) & 1u), (uint8_t)((port >> (2u * e + 1u)) & 1u));
+
+    size_t reads = s->n / 4u;
+    for (size_t i = 0; i < reads; i++) {
+        uint32_t next = random_pairs ? diff_rng(&r) : 0u;
+        for (uint8_t e = 0; e < encoders && !random_pairs; e++) {
+            uint8_t pair = (uint8_t)((port >> (2u * e)) & 3u);
+            pair = diff_quadrature_walk(pair, diff_bit(s->bits, (i * QUADRATURE_BANK_MAX + e) % s->n), diff_rng(&r));
+            next |= (uint32_t)pair << (2u * e);
+        }
+        port = (next & pairs) | (diff_rng(&r) & ~pairs);
+
+        uint16_t forward = 0u, reverse = 0u, invalid = 0u;
+        for (uint8_t e = 0; e < encoders; e++) {
+            uint64_t errors = refs[e].errors;
+            int d = ref_quadrature_update(&refs[e], (uint8_t)((port >> (2u * e)) & 1u),
+                                          (uint8_t)((port >> (2u * e + 1u)) & 1u));
+            if (d > 0) forward |= (uint16_t)(1u << e);
+            if (d < 0) reverse |= (uint16_t)(1u << e);
+            if (refs[e].errors != errors) invalid |= (uint16_t)(1u << e);
+        }
+        DIFF_CHECK("quadrature_bank_update", i, forward | reverse | invalid, quadrature_bank_update(&bank, port));
+        DIFF_CHECK("quadrature_bank: forward", i, forward, bank.forward);
+        DIFF_CHECK("quadrature_bank: reverse", i, reverse, bank.reverse);
+        DIFF_CHECK("quadrature_bank: invalid", i, invalid, bank.invalid);
+        if (i == reads / 2u) {
+            quadrature_bank_set_position(&bank, (uint8_t)(i % encoders), (int32_t)port);
+            refs[i % encoders].position = (int32_t)port;
+        }
+    }
+    for (uint8_t e = 0; e < QUADRATURE_BANK_MAX; e++) {
+        DIFF_CHECK("quadrature_bank_position", e, e < encoders ? refs[e].position : 0,
+                   quadrature_bank_position(&bank, e));
+        DIFF_CHECK("quadrature_bank_errors", e, e < encoders ? refs[e].errors : 0u,
+                   quadrature_bank_errors(&bank, e));
+    }
+}
+
+/* ------------------------------------------------------------------------ */
+/* Schmitt trigger                                                          */
+/* ------------------------------------------------------------------------ */
+
+/* Thresholds: random, straddling the 0x8000 bias, full range, or adjacent. */
+static void diff_schmitt_thresholds(uint32_t v, uint16_t *low, uint16_t *high)
+{
+    uint16_t a = (uint16_t)(v >> 16), b = (uint16_t)v;
+    switch ((v >> 3) & 3u) {
+    case 0u:
+        *low = (a < b) ? a : b;
+        *high = (a < b) ? b : a;
+        if (*low == *high) {
+            if (*high == 0xFFFFu) (*low)--;
+            else (*high)++;
+        }
+        break;
+    case 1u:
+        *low = (uint16_t)(0x7FFFu - (a & 0xFFu));
+        *high = (uint16_t)(0x8000u + (b & 0xFFu));
+        break;
+    case 2u:
+        *low = 0u;
+        *high = 0xFFFFu;
+        break;
+    default:
+        *low = (uint16_t)(a < 0xFFFFu ? a : 0xFFFEu);
+        *high = (uint16_t)(*low + 1u);
+        break;
+    }
+}
+
+/* One ADC sample: in the hold band when `hold` (so that runs of ones in the
+ * stream make long carry chains), otherwise on or beyond a threshold or at
+ * the edges of the signed/unsigned ranges. */
+static uint16_t diff_schmitt_sample(uint16_t low, uint16_t high, uint8_t hold, uint32_t v)
+{
+    static const uint16_t extremes[4] = { 0x0000u, 0x7FFFu, 0x8000u, 0xFFFFu };
+    uint32_t x = v >> 8;
+
+    if (hold && (uint32_t)high - low > 1u) {
+        if ((v & 7u) == 0u) return (uint16_t)(low + 1u);
+        if ((v & 7u) == 1u) return (uint16_t)(high - 1u);
+        return (uint16_t)(low + 1u + x % (uint32_t)(high - low - 1u));
+    }
+    switch (v & 7u) {
+    case 0u: return extremes[x & 3u];
+    case 1u: return high;
+    case 2u: return low;
+    case 3u:
+    case 4u: return (uint16_t)(high + x % (0x10000u - high));
+    default: return (uint16_t)(low - x % (low + 1u));
+    }
+}
+
+static void diff_check_schmitt(const DiffCase *c, const DiffStream *s)
+{
+    uint16_t *samples = malloc((s->n + 1u) * sizeof(*samples));
+    uint8_t *levels = malloc(s->n + 1u);
+    uint8_t *expected = malloc(s->n + 1u);
+    uint64_t *words = malloc((s->n + 1u) * sizeof(*words));
+    if (!samples || !levels || !expected || !words) {
+        diff_report("schmitt: out of memory", 0, 0, 1);
+        goto done;
+    }
+
+    Schmitt st_step, st_buf, st_pk;
+    RefSchmitt ref;
+    uint16_t low, high;
+    DiffRng r;
+    diff_rng_seed(&r, c->seed, 7u);
+    diff_schmitt_thresholds(diff_rng(&r), &low, &high);
+    DIFF_CHECK("schmitt_init: unordered", 0, 0u, schmitt_init(&st_step, high, low, 0u));
+    DIFF_CHECK("schmitt_init: equal", 0, 0u, schmitt_init(&st_step, low, low, 0u));
+    DIFF_CHECK("schmitt_init", 0, 1u, schmitt_init(&st_step, low, high, c->initial));
+    schmitt_init(&st_buf, low, high, c->initial);
+    schmitt_init(&st_pk, low, high, c->initial);
+    ref_schmitt_init(&ref, low, high, c->initial);
+
+    /* Stream bit 1 = hold band: the stream's long runs of ones span blocks */
+    for (size_t i = 0; i < s->n; i++) {
+        uint32_t v = diff_rng(&r);
+        samples[i] = diff_schmitt_sample(low, high, (uint8_t)(s->sample[i] && (v >> 28)), v);
+        expected[i] = ref_schmitt_update(&ref, samples[i]);
+        DIFF_CHECK("schmitt_update", i, expected[i], schmitt_update(&st_step, samples[i]));
+    }
+
+    /* Bulk calls at arbitrary offsets and lengths; every packed chunk is
+     * written from bit 0 of its own buffer */
+    for (size_t pos = 0; pos < s->n;) {
+        size_t len = diff_chunk(&r, s->n - pos);
+        DIFF_CHECK("schmitt_process: state", pos + len - 1u, expected[pos + len - 1u],
+                   schmitt_process(&st_buf, samples + pos, len, levels + pos));
+        pos += len;
+    }
+    for (size_t i = 0; i < s->n; i++)
+        DIFF_CHECK("schmitt_process", i, expected[i], levels[i]);
+
+    for (size_t pos = 0; pos < s->n;) {
+        size_t len = diff_chunk(&r, s->n - pos);
+        s->packed[(len + 7u) / 8u - 1u] = 0xFFu;
+        DIFF_CHECK("schmitt_process_packed: state", pos + len - 1u, expected[pos + len - 1u],
+                   schmitt_process_packed(&st_pk, samples + pos, len, s->packed));
+        for (size_t i = 0; i < len; i++)
+            DIFF_CHECK("schmitt_process_packed", pos + i, expected[pos + i], diff_bit(s->packed, i));
+        if (len % 8u)
+            DIFF_CHECK("schmitt_process_packed: unused bits", pos + len, 0u, s->packed[len / 8u] >> (len % 8u));
+        pos += len;
+    }
+
+    /* Bank: 1..64 channels with thresholds of all kinds, interleaved frames */
+    SchmittBank bank;
+    RefSchmitt refs[SCHMITT_BANK_MAX_CHANNELS];
+    uint16_t lows[SCHMITT_BANK_MAX_CHANNELS], highs[SCHMITT_BANK_MAX_CHANNELS];
+    uint8_t channels = (uint8_t)(1u + (c->seed >> 6) % SCHMITT_BANK_MAX_CHANNELS);
+    uint64_t initial = ((uint64_t)diff_rng(&r) << 32) | diff_rng(&r);
+    uint64_t valid = (channels < 64u) ? ((uint64_t)1u << channels) - 1u : ~(uint64_t)0u;
+    size_t frames = s->n / channels;
+    for (uint8_t ch = 0; ch < channels; ch++) {
+        diff_schmitt_thresholds(diff_rng(&r), &lows[ch], &highs[ch]);
+        ref_schmitt_init(&refs[ch], lows[ch], highs[ch], (uint8_t)((initial >> ch) & 1u));
+    }
+    uint16_t last_high = highs[channels - 1u];
+    highs[channels - 1u] = lows[channels - 1u];
+    DIFF_CHECK("schmitt_bank_init: unordered", channels, 0u, schmitt_bank_init(&bank, lows, highs, channels, initial));
+    highs[channels - 1u] = last_high;
+    DIFF_CHECK("schmitt_bank_init", channels, 1u, schmitt_bank_init(&bank, lows, highs, channels, initial));
+    DIFF_CHECK("schmitt_bank_init: state", channels, initial & valid, bank.state);
+
+    for (size_t f = 0; f < frames; f++) {
+        for (uint8_t ch = 0; ch < channels; ch++) {
+            size_t i = f * channels + ch;
+            uint32_t v = diff_rng(&r);
+            samples[i] = diff_schmitt_sample(lows[ch], highs[ch], (uint8_t)(s->sample[i] && (v >> 28)), v);
+        }
+    }
+    for (size_t f = 0; f < frames;) {
+        size_t len = diff_chunk(&r, frames - f);
+        if (f & 1u) {
+            for (size_t k = 0; k < len; k++) words[f + k] = schmitt_bank_update(&bank, samples + (f + k) * channels);
+        } else {
+            DIFF_CHECK("schmitt_bank_process: frames", f, len,
+                       schmitt_bank_process(&bank, samples + f * channels, len, words + f));
+        }
+        for (size_t k = 0; k < len; k++) {
+            uint64_t want = 0u;
+            for (uint8_t ch = 0; ch < channels; ch++)
+                want |= (uint64_t)ref_schmitt_update(&refs[ch], samples[(f + k) * channels + ch]) << ch;
+            DIFF_CHECK((f & 1u) ? "schmitt_bank_update" : "schmitt_bank_process", f + k, want, words[f + k]);
+        }
+        f += len;
+    }
+
+done:
+    free(samples);
+    free(levels);
+    free(expected);
+    free(words);
+}
+
+#if defined(CLIB_DIFF_ENGINE)
+/* ------------------------------------------------------------------------ */
+/* Host engine                                                              */
+/* ------------------------------------------------------------------------ */
+
+/* 41 words: six line-sized shards, the last one partial. With `shift`,
+ * prev and the ports start one element into a line: shards then start at
+ * words 7, 15, ..., the only words where all the arrays line up. */
+#define DIFF_ENGINE_CHANNELS 2600u
+#define DIFF_ENGINE_WORDS EDGE_ARRAY_WORDS(DIFF_ENGINE_CHANNELS)
+#define DIFF_ENGINE_ROWS 64u
+
+static uint32_t diff_popcount(uint64_t x)
+{
+    uint32_t n = 0u;
+    for (; x; x &= x - 1u) n++;
+    return n;
+}
+
+/* Every member size is a whole number of cache lines. */
+typedef struct {
+    uint64_t prev[48];
+    uint32_t rise[DIFF_ENGINE_WORDS * 64u];
+    uint32_t fall[DIFF_ENGINE_WORDS * 64u];
+    DebouncePort ports[48];
+    EdgeArray arr;
+} DiffEngineBank;
+
+static void diff_check_engine(const DiffCase *c, const DiffStream *s)
+{
+    size_t nwords = s->n / 64u;
+    if (nwords < 2u) return;
+
+    uint8_t *block = malloc(2u * sizeof(DiffEngineBank) + 64u);
+    uint64_t *rows = malloc(DIFF_ENGINE_ROWS * DIFF_ENGINE_WORDS * sizeof(uint64_t));
+    if (!block || !rows) {
+        diff_report("shard_engine: out of memory", 0, 0, 1);
+        goto done;
+    }
+    DiffEngineBank *banks = (DiffEngineBank *)(void *)(block + (64u - (uintptr_t)block % 64u) % 64u);
+    DiffEngineBank *eng = &banks[0], *ref = &banks[1];
+    uint8_t debounced = (uint8_t)(c->seed & 2u);
+    uint32_t shift = (c->seed >> 2) & 1u;
+    uint32_t threads = 1u + c->seed % 6u;
+    uint64_t *prev = eng->prev + shift;
+    DebouncePort *ports = eng->ports + shift;
+    ShardEngine engine;
+    DiffRng r;
+
+    /* The stream's words, repeated; row 0 is the initial state */
+    for (size_t w = 0; w < DIFF_ENGINE_ROWS * DIFF_ENGINE_WORDS; w++)
+        rows[w] = diff_word(s->bits, w % nwords) ^ (w / nwords);
+    edge_array_init(&eng->arr, prev, eng->rise, eng->fall, DIFF_ENGINE_CHANNELS);
+    edge_array_init(&ref->arr, ref->prev, ref->rise, ref->fall, DIFF_ENGINE_CHANNELS);
+    for (uint32_t w = 0; w < DIFF_ENGINE_WORDS; w++) {
+        edge_array_set_word(&eng->arr, w, rows[w]);
+        edge_array_set_word(&ref->arr, w, rows[w]);
+        debounce_port_init(&ports[w], c->port_samples, rows[w]);
+        debounce_port_init(&ref->ports[w], c->port_samples, rows[w]);
+    }
+
+    if (!shard_engine_start(&engine, &eng->arr, debounced ? ports : 0, threads)) {
+        diff_report("shard_engine_start", 0, 1, 0);
+        goto done;
+    }
+    DIFF_CHECK("shard_engine: threads", 0, threads, engine.thread_count);
+    for (uint32_t k = 0; k < engine.thread_count; k++) {
+        uint32_t first = engine.workers[k].first_word;
+        uintptr_t misaligned = (uintptr_t)&prev[first] % 64u | (uintptr_t)&eng->rise[first * 64u] % 64u |
+                               (uintptr_t)&eng->fall[first * 64u] % 64u |
+                               (debounced ? (uintptr_t)&ports[first] % 64u : 0u);
+        /* Empty shards touch nothing */
+        uint8_t empty = (first == engine.workers[k].end_word);
+        DIFF_CHECK("shard_engine: shard alignment", k, 0u, (k && !empty) ? misaligned : 0u);
+        DIFF_CHECK("shard_engine: shard start", k, k ? engine.workers[k - 1u].end_word : 0u, first);
+    }
+    DIFF_CHECK("shard_engine: last shard end", threads, DIFF_ENGINE_WORDS,
+               engine.workers[engine.thread_count - 1u].end_word);
+
+    diff_rng_seed(&r, c->seed, 5u);
+    uint64_t rises = 0u, falls = 0u;
+    for (size_t row = 1; row < DIFF_ENGINE_ROWS;) {
+        size_t len = 1u + diff_rng(&r) % 16u;
+        if (len > DIFF_ENGINE_ROWS - row) len = DIFF_ENGINE_ROWS - row;
+        uint64_t expected = 0u;
+        for (size_t t = row; t < row + len; t++) {
+            for (uint32_t w = 0; w < DIFF_ENGINE_WORDS; w++) {
+                uint64_t sample = rows[t * DIFF_ENGINE_WORDS + w];
+                if (debounced) sample = debounce_port_update(&ref->ports[w], sample);
+                uint64_t changed = edge_array_update_word(&ref->arr, w, sample);
+                rises += diff_popcount(changed & sample);
+                falls += diff_popcount(changed & ~sample);
+                expected += diff_popcount(changed);
+            }
+        }
+        DIFF_CHECK("shard_engine_process", row, expected,
+                   shard_engine_process(&engine, rows + row * DIFF_ENGINE_WORDS, len));
+        row += len;
+    }
+    shard_engine_stop(&engine);
+
+    uint64_t total_rises, total_falls;
+    shard_engine_totals(&engine, &total_rises, &total_falls);
+    DIFF_CHECK("shard_engine: total rises", DIFF_ENGINE_ROWS, rises, total_rises);
+    DIFF_CHECK("shard_engine: total falls", DIFF_ENGINE_ROWS, falls, total_falls);
+    for (uint32_t w = 0; w < DIFF_ENGINE_WORDS; w++)
+        DIFF_CHECK("shard_engine: prev", w, ref->prev[w], prev[w]);
+    for (uint32_t ch = 0; ch < DIFF_ENGINE_CHANNELS; ch++) {
+        DIFF_CHECK("shard_engine: rise_count", ch, ref->rise[ch], eng->rise[ch]);
+        DIFF_CHECK("shard_engine: fall_count", ch, ref->fall[ch], eng->fall[ch]);
+    }
+
+done:
+    free(rows);
+    free(block);
+}
+#endif
+
+/* ------------------------------------------------------------------------ */
+/* Entry points                                                             */
+/* ------------------------------------------------------------------------ */
+
+void diff_case_from_bytes(DiffCase *c, const uint8_t *data, size_t size)
+{
+    uint8_t h[DIFF_HEADER_BYTES] = { 0 };
+    size_t head = size < DIFF_HEADER_BYTES ? size : DIFF_HEADER_BYTES;
+    if (head) memcpy(h, data, head);
+
+    c->bits = data + head;
+    c->nbits = 8u * (size - head);
+    c->initial = h[0] & 1u;
+    c->settle = h[1];
+    c->limit = (uint8_t)(h[2] % 32u + 1u);
+    c->vote_m = (uint8_t)(h[4] % 32u + 1u);
+    c->vote_n = (uint8_t)(h[3] % c->vote_m + 1u);
+    c->glitch_width = (uint8_t)(h[5] % 100u + 1u);
+    c->port_samples = (uint8_t)(h[6] % 15u + 1u);
+    c->channels = (uint8_t)(h[7] % DIFF_MAX_CHANNELS + 1u);
+    c->seed = (uint32_t)h[8] | ((uint32_t)h[9] << 8) | ((uint32_t)h[10] << 16) | ((uint32_t)h[11] << 24);
+}
+
+uint32_t diff_run_case(const DiffCase *c)
+{
+    DiffStream s;
+    uint32_t before = diff_failures;
+
+    if (!c || (!c->bits && c->nbits)) return 0;
+    if (!diff_stream_init(&s, c)) {
+        diff_report("out of memory", 0, 0, 1);
+        diff_stream_free(&s);
+        return diff_failures - before;
+    }
+
+    diff_check_edge_scalar(c, &s);
+    diff_check_edge_bulk(c, &s);
+    diff_check_glitch(c, &s);
+    diff_check_edge_words(c, &s);
+    diff_check_debounce_scalar(c, &s);
+    diff_check_debounce_words(c, &s);
+    diff_check_quadrature(c, &s);
+    diff_check_schmitt(c, &s);
+#if defined(CLIB_DIFF_ENGINE)
+    diff_check_engine(c, &s);
+#endif
+#if defined(CLIB_DIFF_TEMPLATES)
+    diff_check_templates(c, s.sample, s.ts);
+#endif
+#if defined(CLIB_DIFF_STREAM)
+    diff_check_stream(c);
+#endif
+
+    diff_stream_free(&s);
+    return diff_failures - before;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file    diff_harness.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Differential test of the fast paths against the reference models.
+ * @license MIT
+ *
+ * @details
+ * One DiffCase (a packed sample stream plus a handful of parameters) is
+ * replayed through the optimized entry points of the Edge Detector and
+ * Debounce modules: the scalar and bulk edge calls with their hooks
+ * (callback, queue, timing, history), word-wide banks and arrays, the ROM
+ * tables, the SIMD and packed stream kernels, the glitch filter, all
+ * debounce modes, the port and wheel debouncers, the fused
+ * debounced-edge stages, the quadrature decoder and bank and the Schmitt
+ * trigger buffer and bank calls. Edge types, positions and timestamps,
+ * callback order, timing estimates, counters, debounced outputs, encoder
+ * deltas and comparator levels must match the models of diff_reference.h
+ * sample for sample.
+ *
+ * The same entry point serves the `clib_diff` test driver (random and
+ * adversarial streams) and the libFuzzer target (`CLIB_FUZZ`), which feeds
+ * arbitrary bytes through `diff_case_from_bytes()`.
+ */
+
+#ifndef DIFF_HARNESS_H
+#define DIFF_HARNESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Bytes of fuzzer input consumed by the case parameters. */
+#define DIFF_HEADER_BYTES 12u
+
+/** @brief Longest stream replayed per case, in samples. */
+#define DIFF_MAX_SAMPLES (1u << 16)
+
+/**
+ * @struct DiffCase
+ * @brief One differential test case.
+ */
+typedef struct {
+    const uint8_t *bits;    /**< Samples, 1 bit each, LSB-first. */
+    size_t nbits;           /**< Number of samples. */
+    uint32_t seed;          /**< Drives timestamps, chunk sizes and sample byte values. */
+    uint8_t initial;        /**< Initial level of the single-signal paths. */
+    uint8_t settle;         /**< Debounce settle time in ticks. */
+    uint8_t limit;          /**< Integrator limit (1..255). */
+    uint8_t vote_n;         /**< Majority threshold. */
+    uint8_t vote_m;         /**< Majority window (1..32). */
+    uint8_t glitch_width;   /**< Glitch filter width (1..100). */
+    uint8_t port_samples;   /**< Port debouncer sample count (1..15). */
+    uint8_t channels;       /**< Channels of the array and table paths (1..192). */
+} DiffCase;
+
+/**
+ * @brief Builds a case from arbitrary bytes (fuzzer input).
+ * @param c Case to fill; `bits` points into `data`.
+ * @param data Input bytes: DIFF_HEADER_BYTES of parameters, then the stream.
+ * @param size Number of input bytes.
+ */
+void diff_case_from_bytes(DiffCase *c, const uint8_t *data, size_t size);
+
+/**
+ * @brief Replays a case through every path and compares with the models.
+ * @param c Case to run.
+ * @return Number of mismatches (0 = all paths agree).
+ *
+ * @details
+ * The first mismatches are described on stderr with the path name and the
+ * sample index.
+ */
+uint32_t diff_run_case(const DiffCase *c);
+
+/**
+ * @brief Reports a mismatch (shared with the C++ checks).
+ * @param path Name of the diverging path.
+ * @param index Sample (or step) index of the mismatch.
+ * @param expected Reference value.
+ * @param actual Value produced by the path.
+ */
+void diff_report(const char *path, size_t index, uint64_t expected, uint64_t actual);
+
+#if defined(CLIB_DIFF_TEMPLATES)
+/**
+ * @brief Checks the C++17 templates (diff_templates.cpp), reporting
+ *        through `diff_report()`.
+ */
+void diff_check_templates(const DiffCase *c, const uint8_t *samples, const uint32_t *ts);
+#endif
+
+#if defined(CLIB_DIFF_STREAM)
+/**
+ * @brief Checks the C++20 edge stream (diff_stream.cpp), reporting
+ *        through `diff_report()`.
+ */
+void diff_check_stream(const DiffCase *c);
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DIFF_HARNESS_H */
@@ -0,0 +1,129 @@
+/**
+ * @file    diff_main.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Differential test driver (random and adversarial streams).
+ * @license MIT
+ *
+ * @details
+ * Usage: `clib_diff [cases] [seed]`. Every case gets random parameters and
+ * a stream from one of the generators below; the adversarial ones target
+ * word boundaries, run lengths around the glitch width and the settle
+ * time, constant and maximally toggling inputs. Exits with 1 on the first
+ * case that disagrees with the reference models.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "diff_harness.h"
+
+#define DIFF_MAX_BYTES 4096u
+
+static uint32_t rng_state;
+
+static uint32_t rng(void)
+{
+    uint32_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return rng_state = x;
+}
+
+static void set_bit(uint8_t *bits, size_t i, uint8_t v)
+{
+    if (v) bits[i / 8u] |= (uint8_t)(1u << (i % 8u));
+    else bits[i / 8u] &= (uint8_t)~(1u << (i % 8u));
+}
+
+/* Runs of random length up to `max_run` (>= 1). */
+static void gen_runs(uint8_t *bits, size_t nbits, uint32_t max_run)
+{
+    uint8_t level = (uint8_t)(rng() & 1u);
+    for (size_t i = 0; i < nbits;) {
+        uint32_t run = 1u + rng() % max_run;
+        for (; run && i < nbits; run--, i++) set_bit(bits, i, level);
+        level ^= 1u;
+    }
+}
+
+/* Sparse toggles placed right around 64-sample word boundaries. */
+static void gen_boundaries(uint8_t *bits, size_t nbits)
+{
+    uint8_t level = (uint8_t)(rng() & 1u);
+    for (size_t i = 0; i < nbits; i++) {
+        size_t pos = i % 64u;
+        if ((pos == 0u || pos == 63u || pos == 1u) && (rng() & 1u)) level ^= 1u;
+        set_bit(bits, i, level);
+    }
+}
+
+/* Mostly quiet with rare bursts of bounce. */
+static void gen_bursts(uint8_t *bits, size_t nbits)
+{
+    uint8_t level = (uint8_t)(rng() & 1u);
+    for (size_t i = 0; i < nbits; i++) {
+        if (rng() % 500u == 0u) {
+            uint32_t burst = 1u + rng() % 40u;
+            for (; burst && i < nbits; burst--, i++) set_bit(bits, i, (uint8_t)(rng() & 1u));
+            level ^= 1u;
+        }
+        if (i < nbits) set_bit(bits, i, level);
+    }
+}
+
+static void gen_case(uint8_t *buf, size_t *size, uint32_t index)
+{
+    size_t n = DIFF_HEADER_BYTES + 1u + rng() % (DIFF_MAX_BYTES - DIFF_HEADER_BYTES);
+    uint8_t *bits = buf + DIFF_HEADER_BYTES;
+    size_t nbits = 8u * (n - DIFF_HEADER_BYTES);
+    uint32_t width;
+
+    for (size_t i = 0; i < DIFF_HEADER_BYTES; i++) buf[i] = (uint8_t)rng();
+    /* Keep edge values of the parameters frequent */
+    switch (rng() % 4u) {
+    case 0: buf[1] = 0u; buf[5] = 0u; break;         /* settle 0, width 1 */
+    case 1: buf[5] = (uint8_t)(63u + rng() % 3u); break; /* width 64..66 */
+    case 2: buf[7] = (uint8_t)(63u + 64u * (rng() % 3u)); break; /* full words */
+    default: break;
+    }
+    width = (uint32_t)buf[5] % 100u + 1u;
+
+    switch (index % 8u) {
+    case 0: for (size_t i = DIFF_HEADER_BYTES; i < n; i++) buf[i] = (uint8_t)rng(); break;
+    case 1: memset(bits, (rng() & 1u) ? 0xFF : 0x00, n - DIFF_HEADER_BYTES); break;
+    case 2: memset(bits, (rng() & 1u) ? 0xAA : 0x55, n - DIFF_HEADER_BYTES); break;
+    case 3: gen_runs(bits, nbits, width + 1u); break;
+    case 4: gen_runs(bits, nbits, 2u + (uint32_t)buf[1]); break;
+    case 5: gen_runs(bits, nbits, 130u); break;
+    case 6: gen_boundaries(bits, nbits); break;
+    default: gen_bursts(bits, nbits); break;
+    }
+    *size = n;
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t buf[DIFF_MAX_BYTES];
+    uint32_t cases = (argc > 1) ? (uint32_t)strtoul(argv[1], 0, 0) : 400u;
+    uint32_t seed = (argc > 2) ? (uint32_t)strtoul(argv[2], 0, 0) : 0x5EEDu;
+
+    for (uint32_t i = 0; i < cases; i++) {
+        DiffCase c;
+        size_t size;
+        rng_state = (seed ^ (i * 0x9E3779B9u)) | 1u;
+        gen_case(buf, &size, i);
+        diff_case_from_bytes(&c, buf, size);
+        uint32_t failures = diff_run_case(&c);
+        if (failures) {
+            fprintf(stderr, "clib_diff: case %lu (seed 0x%lx): %lu mismatches\n",
+                    (unsigned long)i, (unsigned long)seed, (unsigned long)failures);
+            return 1;
+        }
+    }
+    printf("clib_diff: %lu cases, all paths agree\n", (unsigned long)cases);
+    return 0;
+}
@@ -0,0 +1,344 @@
+/**
+ * @file    diff_reference.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Frozen scalar reference models for the differential harness.
+ * @license MIT
+ *
+ * @details
+ * Plain one-sample-at-a-time restatements of the documented semantics of
+ * `edge_update()`, the glitch filter, the debounce modes, the vertical
+ * counter port debouncer, the quadrature decoder and the Schmitt trigger.
+ * They share no code with the library on purpose: whatever build
+ * options, SIMD kernels or table layouts the library uses, its results
+ * must stay identical to these models.
+ *
+ * Do not "optimize" this file. A change here is a change of the library's
+ * contract and needs the same review as one.
+ */
+
+#ifndef DIFF_REFERENCE_H
+#define DIFF_REFERENCE_H
+
+#include <stdint.h>
+
+/** @brief Edge type codes of the models (same values as EdgeType). */
+enum { REF_NONE = 0, REF_RISING = 1, REF_FALLING = 2 };
+
+/* ------------------------------------------------------------------------ */
+/* Edge detector                                                            */
+/* ------------------------------------------------------------------------ */
+
+typedef struct {
+    uint8_t level;
+    uint64_t rises;
+    uint64_t falls;
+} RefEdge;
+
+static inline void ref_edge_init(RefEdge *r, uint8_t level)
+{
+    r->level = level ? 1u : 0u;
+    r->rises = 0u;
+    r->falls = 0u;
+}
+
+static inline int ref_edge_update(RefEdge *r, uint8_t input)
+{
+    input = input ? 1u : 0u;
+    if (input == r->level) return REF_NONE;
+    r->level = input;
+    if (input) {
+        r->rises++;
+        return REF_RISING;
+    }
+    r->falls++;
+    return REF_FALLING;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Edge timing                                                              */
+/* ------------------------------------------------------------------------ */
+
+typedef struct {
+    uint32_t rise_at;
+    uint32_t fall_at;
+    uint32_t high;      /* 0 until measured */
+    uint32_t low;
+    uint32_t period;
+    uint8_t shift;
+    uint8_t rose;
+    uint8_t fell;
+} RefTiming;
+
+static inline void ref_timing_init(RefTiming *r, uint8_t shift)
+{
+    r->rise_at = r->fall_at = 0u;
+    r->high = r->low = r->period = 0u;
+    r->shift = shift;
+    r->rose = r->fell = 0u;
+}
+
+/* Moves the estimate 1/2^shift of the way to the sample, to the nearest tick
+ * (halves away from the estimate); the first sample is taken as is. */
+static inline uint32_t ref_timing_average(const RefTiming *r, uint32_t estimate, uint32_t sample)
+{
+    if (!r->shift || !estimate) return sample;
+    int64_t d = (int64_t)sample - (int64_t)estimate;
+    int64_t step = ((d < 0 ? -d : d) + ((int64_t)1 << (r->shift - 1u))) >> r->shift;
+    return (uint32_t)(d < 0 ? (int64_t)estimate - step : (int64_t)estimate + step);
+}
+
+/* High: rise to fall, low: fall to rise, period: rise to rise. */
+static inline void ref_timing_edge(RefTiming *r, int type, uint32_t now)
+{
+    if (type == REF_RISING) {
+        if (r->fell) r->low = ref_timing_average(r, r->low, now - r->fall_at);
+        if (r->rose) r->period = ref_timing_average(r, r->period, now - r->rise_at);
+        r->rise_at = now;
+        r->rose = 1u;
+    }
+    else if (type == REF_FALLING) {
+        if (r->rose) r->high = ref_timing_average(r, r->high, now - r->rise_at);
+        r->fall_at = now;
+        r->fell = 1u;
+    }
+}
+
+/* ------------------------------------------------------------------------ */
+/* Minimum pulse width filter (per sample and per tick)                     */
+/* ------------------------------------------------------------------------ */
+
+typedef struct {
+    RefEdge out;
+    uint32_t width;
+    uint32_t run;
+    uint32_t changed_at;
+    uint8_t raw;
+} RefGlitch;
+
+static inline void ref_glitch_init(RefGlitch *r, uint8_t level, uint32_t width)
+{
+    ref_edge_init(&r->out, level);
+    r->width = width ? width : 1u;
+    r->run = r->width;
+    r->changed_at = 0u;
+    r->raw = r->out.level;
+}
+
+/* A level is passed on once it has been seen on `width` consecutive samples. */
+static inline int ref_glitch_update(RefGlitch *r, uint8_t input)
+{
+    input = input ? 1u : 0u;
+    if (input != r->raw) {
+        r->raw = input;
+        r->run = 0u;
+    }
+    if (r->run < r->width) r->run++;
+    if (r->run >= r->width) return ref_edge_update(&r->out, r->raw);
+    return REF_NONE;
+}
+
+/* A level is passed on once it has been present for `width` ticks. */
+static inline int ref_glitch_update_at(RefGlitch *r, uint8_t input, uint32_t now)
+{
+    input = input ? 1u : 0u;
+    if (input != r->raw) {
+        r->raw = input;
+        r->changed_at = now;
+    }
+    if ((uint32_t)(now - r->changed_at) >= r->width) return ref_edge_update(&r->out, r->raw);
+    return REF_NONE;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Debounce                                                                 */
+/* ------------------------------------------------------------------------ */
+
+/* Tick mode; settle 0 is also the behaviour without a time_ref(). */
+typedef struct {
+    uint8_t raw;
+    uint8_t stable;
+    uint32_t changed_at;
+    uint32_t settle;
+} RefDebounce;
+
+static inline void ref_debounce_init(RefDebounce *r, uint32_t settle, uint8_t level, uint32_t now)
+{
+    r->raw = level ? 1u : 0u;
+    r->stable = r->raw;
+    r->changed_at = now;
+    r->settle = settle;
+}
+
+static inline uint8_t ref_debounce_update(RefDebounce *r, uint8_t input, uint32_t now)
+{
+    input = input ? 1u : 0u;
+    if (input != r->raw) {
+        r->raw = input;
+        r->changed_at = now;
+    } else if ((uint32_t)(now - r->changed_at) >= r->settle) {
+        r->stable = input;
+    }
+    return r->stable;
+}
+
+/* Saturating integrator: output follows the counter's end stops. */
+typedef struct {
+    uint32_t count;
+    uint32_t limit;
+    uint8_t stable;
+} RefIntegrator;
+
+static inline void ref_integrator_init(RefIntegrator *r, uint32_t limit, uint8_t level)
+{
+    r->limit = limit ? limit : 1u;
+    r->stable = level ? 1u : 0u;
+    r->count = r->stable ? r->limit : 0u;
+}
+
+static inline uint8_t ref_integrator_update(RefIntegrator *r, uint8_t input)
+{
+    if (input) {
+        if (r->count < r->limit) r->count++;
+    } else if (r->count > 0u) {
+        r->count--;
+    }
+    if (r->count == r->limit) r->stable = 1u;
+    else if (r->count == 0u) r->stable = 0u;
+    return r->stable;
+}
+
+/* N-of-M vote; the window starts filled with the initial level. */
+#define REF_MAJORITY_MAX 32u
+
+typedef struct {
+    uint8_t window[REF_MAJORITY_MAX];
+    uint32_t n;
+    uint32_t m;
+    uint32_t pos;
+    uint8_t stable;
+} RefMajority;
+
+static inline void ref_majority_init(RefMajority *r, uint32_t n, uint32_t m, uint8_t level)
+{
+    if (m == 0u) m = 1u;
+    if (m > REF_MAJORITY_MAX) m = REF_MAJORITY_MAX;
+    if (n == 0u) n = 1u;
+    if (n > m) n = m;
+    r->n = n;
+    r->m = m;
+    r->pos = 0u;
+    r->stable = level ? 1u : 0u;
+    for (uint32_t i = 0; i < REF_MAJORITY_MAX; i++) r->window[i] = r->stable;
+}
+
+static inline uint8_t ref_majority_update(RefMajority *r, uint8_t input)
+{
+    uint32_t ones = 0u;
+    r->window[r->pos] = input ? 1u : 0u;
+    r->pos = (r->pos + 1u) % r->m;
+    for (uint32_t i = 0; i < r->m; i++) ones += r->window[i];
+    if (ones >= r->n) r->stable = 1u;
+    else if (r->m - ones >= r->n) r->stable = 0u;
+    return r->stable;
+}
+
+/* Port debouncer: a pin toggles after `samples` consecutive disagreeing samples. */
+typedef struct {
+    uint32_t count;
+    uint32_t samples;
+    uint8_t stable;
+} RefPortPin;
+
+static inline void ref_port_pin_init(RefPortPin *r, uint32_t samples, uint8_t level)
+{
+    r->count = 0u;
+    r->samples = samples ? samples : 1u;
+    r->stable = level ? 1u : 0u;
+}
+
+static inline uint8_t ref_port_pin_update(RefPortPin *r, uint8_t input)
+{
+    input = input ? 1u : 0u;
+    if (input == r->stable) {
+        r->count = 0u;
+    } else if (++r->count >= r->samples) {
+        r->stable = input;
+        r->count = 0u;
+    }
+    return r->stable;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Quadrature decoder                                                       */
+/* ------------------------------------------------------------------------ */
+
+/* x4 decoding by Gray phase: forward is 00 -> 01 -> 11 -> 10 -> 00 (B A),
+ * a phase step of 2 (both channels changed) is an error. */
+typedef struct {
+    uint8_t a;
+    uint8_t b;
+    int64_t position;
+    uint64_t errors;
+} RefQuadrature;
+
+static inline void ref_quadrature_init(RefQuadrature *r, uint8_t a, uint8_t b)
+{
+    r->a = a ? 1u : 0u;
+    r->b = b ? 1u : 0u;
+    r->position = 0;
+    r->errors = 0u;
+}
+
+static inline unsigned ref_quadrature_phase(uint8_t a, uint8_t b)
+{
+    if (!b) return a ? 1u : 0u;
+    return a ? 2u : 3u;
+}
+
+static inline int ref_quadrature_update(RefQuadrature *r, uint8_t a, uint8_t b)
+{
+    a = a ? 1u : 0u;
+    b = b ? 1u : 0u;
+    unsigned step = (ref_quadrature_phase(a, b) + 4u - ref_quadrature_phase(r->a, r->b)) % 4u;
+    r->a = a;
+    r->b = b;
+    if (step == 1u) {
+        r->position++;
+        return 1;
+    }
+    if (step == 3u) {
+        r->position--;
+        return -1;
+    }
+    if (step == 2u) r->errors++;
+    return 0;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Schmitt trigger                                                          */
+/* ------------------------------------------------------------------------ */
+
+/* Goes high at or above `high`, low at or below `low`, holds in between. */
+typedef struct {
+    uint32_t low;
+    uint32_t high;
+    uint8_t state;
+} RefSchmitt;
+
+static inline void ref_schmitt_init(RefSchmitt *r, uint32_t low, uint32_t high, uint8_t level)
+{
+    r->low = low;
+    r->high = high;
+    r->state = level ? 1u : 0u;
+}
+
+static inline uint8_t ref_schmitt_update(RefSchmitt *r, uint32_t sample)
+{
+    if (sample >= r->high) r->state = 1u;
+    else if (sample <= r->low) r->state = 0u;
+    return r->state;
+}
+
+#endif /* DIFF_REFERENCE_H */
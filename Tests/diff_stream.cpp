@@ -0,0 +1,179 @@
+/**
+ * @file    diff_stream.cpp
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Differential checks of the C++20 edge stream.
+ * @license MIT
+ *
+ * @details
+ * Built into `clib_diff` (and the fuzz target) when a C++20 compiler is
+ * available. The case's words are fed as rows to an EdgeStream by a
+ * producer coroutine; up to 13 consumer coroutines own contiguous channel
+ * ranges, with small rings so that backpressure and ring wraps happen
+ * constantly. Every subscriber must receive exactly the edges of the
+ * scalar model for its channels, in row then channel order, and every
+ * wake-up must hand out at least `batch` events.
+ */
+
+#include "diff_harness.h"
+#include "diff_reference.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "edge_stream.hpp"
+
+namespace {
+
+constexpr std::uint32_t max_subscribers = 13u;
+
+struct StreamLog {
+    clib::EdgeSubscriber *sub = nullptr;
+    const clib::EdgeStreamEvent *ring = nullptr;
+    std::size_t cap = 0u;
+    std::size_t batch = 0u;
+    std::size_t carried = 0u;       // Events of a wake-up split at the ring end
+    std::uint64_t split_step = 0u;  // Row at which it was split
+    bool split = false;
+    bool done = false;
+    std::uint32_t short_batches = 0u;
+    std::vector<clib::EdgeStreamEvent> events;
+};
+
+clib::EdgeTask consume(StreamLog &log, const clib::EdgeStream &stream)
+{
+    for (;;) {
+        auto batch = co_await log.sub->next();
+        if (batch.empty()) break;
+        log.events.insert(log.events.end(), batch.begin(), batch.end());
+
+        /* The rest of a split wake-up comes before any further row */
+        if (log.split && stream.step() != log.split_step) log.short_batches++;
+        std::size_t total = batch.size() + (log.split ? log.carried : 0u);
+        log.split = (batch.data() + batch.size() == log.ring + log.cap) && log.sub->pending() != 0u;
+        if (log.split) {
+            log.carried = total;
+            log.split_step = stream.step();
+        }
+        else if (total < log.batch && !stream.closed()) {
+            log.short_batches++;
+        }
+    }
+    log.done = true;
+}
+
+clib::EdgeTask produce(clib::EdgeStream &stream, const std::uint64_t *rows, std::size_t n,
+                       std::uint32_t words, std::size_t chunk, bool &finished)
+{
+    for (std::size_t done = 0; done < n;) {
+        std::size_t len = (n - done < chunk) ? n - done : chunk;
+        std::size_t k = stream.update_rows(rows + done * words, len);
+        done += k;
+        if (k < len) co_await stream.writable();
+    }
+    stream.close();
+    finished = true;
+}
+
+std::uint64_t load_word(const std::uint8_t *bits, std::size_t word)
+{
+    std::uint64_t w = 0u;
+    for (unsigned b = 0; b < 8u; b++)
+        w |= static_cast<std::uint64_t>(bits[word * 8u + b]) << (8u * b);
+    return w;
+}
+
+} // namespace
+
+extern "C" void diff_check_stream(const DiffCase *c)
+{
+    std::size_t n = c->nbits < DIFF_MAX_SAMPLES ? c->nbits : DIFF_MAX_SAMPLES;
+    std::uint32_t channels = c->channels;
+    std::uint32_t words = EDGE_ARRAY_WORDS(channels);
+    std::size_t steps = n / 64u / words;
+    if (steps < 2u) return;
+
+    /* Row 0 is the initial state, as in the array checks */
+    std::vector<std::uint64_t> rows(steps * words);
+    for (std::size_t w = 0; w < rows.size(); w++) rows[w] = load_word(c->bits, w);
+
+    std::vector<std::uint64_t> prev(words);
+    std::vector<std::uint32_t> rise(channels), fall(channels);
+    ::EdgeArray arr;
+    edge_array_init(&arr, prev.data(), rise.data(), fall.data(), channels);
+    for (std::uint32_t w = 0; w < words; w++) edge_array_set_word(&arr, w, rows[w]);
+
+    /* Contiguous ranges with gaps, rings of 1..3 rows of room plus a few slots */
+    std::uint32_t rng = c->seed * 2654435761u + 1u;
+    auto next_rand = [&rng](std::uint32_t bound) {
+        rng = rng * 1664525u + 1013904223u;
+        return (rng >> 8) % bound;
+    };
+    std::vector<std::unique_ptr<clib::EdgeSubscriber>> subs;
+    std::vector<std::vector<clib::EdgeStreamEvent>> rings;
+    std::vector<std::uint32_t> firsts, widths;
+    std::vector<StreamLog> logs(max_subscribers);
+    std::vector<clib::EdgeSubscriber *> routes(channels);
+    clib::EdgeStream stream(arr, routes);
+    rings.reserve(max_subscribers);
+
+    for (std::uint32_t ch = next_rand(3u); ch < channels && subs.size() < max_subscribers;) {
+        std::uint32_t width = 1u + next_rand(channels / 8u + 1u);
+        if (width > channels - ch) width = channels - ch;
+        std::size_t cap = width * (1u + next_rand(3u)) + next_rand(4u);
+        std::size_t batch = 1u + next_rand(static_cast<std::uint32_t>(cap - width + 1u));
+        rings.emplace_back(cap);
+        subs.push_back(std::make_unique<clib::EdgeSubscriber>(rings.back(), batch));
+        if (!stream.subscribe(*subs.back(), ch, width))
+            diff_report("edge_stream: subscribe", ch, 1u, 0u);
+
+        StreamLog &log = logs[subs.size() - 1u];
+        log.sub = subs.back().get();
+        log.ring = rings.back().data();
+        log.cap = cap;
+        log.batch = batch;
+        firsts.push_back(ch);
+        widths.push_back(width);
+        ch += width + next_rand(2u);
+    }
+    for (std::size_t k = 0; k < subs.size(); k++) consume(logs[k], stream);
+
+    bool finished = false;
+    produce(stream, rows.data() + words, steps - 1u, words, 1u + next_rand(64u), finished);
+    if (!finished) diff_report("edge_stream: producer finished", steps, 1u, 0u);
+
+    /* Scalar model of every channel, in row then channel order */
+    std::vector<RefEdge> refs(channels);
+    std::vector<std::vector<clib::EdgeStreamEvent>> expected(subs.size());
+    std::vector<std::uint32_t> owner(channels, max_subscribers);
+    for (std::size_t k = 0; k < subs.size(); k++)
+        for (std::uint32_t ch = firsts[k]; ch < firsts[k] + widths[k]; ch++) owner[ch] = static_cast<std::uint32_t>(k);
+    for (std::uint32_t ch = 0; ch < channels; ch++)
+        ref_edge_init(&refs[ch], static_cast<std::uint8_t>((rows[ch / 64u] >> (ch % 64u)) & 1u));
+    for (std::size_t r = 1; r < steps; r++) {
+        for (std::uint32_t ch = 0; ch < channels; ch++) {
+            std::uint8_t bit = static_cast<std::uint8_t>((rows[r * words + ch / 64u] >> (ch % 64u)) & 1u);
+            int t = ref_edge_update(&refs[ch], bit);
+            if (t == REF_NONE || owner[ch] == max_subscribers) continue;
+            EdgeType type = (t == REF_RISING) ? EDGE_RISING : EDGE_FALLING;
+            expected[owner[ch]].push_back(clib::EdgeStreamEvent{ r - 1u, ch, type });
+        }
+    }
+
+    for (std::size_t k = 0; k < subs.size(); k++) {
+        const StreamLog &log = logs[k];
+        if (!log.done) diff_report("edge_stream: consumer finished", k, 1u, 0u);
+        if (log.short_batches) diff_report("edge_stream: short batch", k, 0u, log.short_batches);
+        if (log.events.size() != expected[k].size())
+            diff_report("edge_stream: events", k, expected[k].size(), log.events.size());
+        for (std::size_t e = 0; e < log.events.size() && e < expected[k].size(); e++) {
+            const clib::EdgeStreamEvent &want = expected[k][e];
+            const clib::EdgeStreamEvent &got = log.events[e];
+            if (want.step != got.step) diff_report("edge_stream: step", e, want.step, got.step);
+            if (want.channel != got.channel) diff_report("edge_stream: channel", e, want.channel, got.channel);
+            if (want.type != got.type) diff_report("edge_stream: type", e, want.type, got.type);
+        }
+    }
+}
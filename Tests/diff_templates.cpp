@@ -0,0 +1,81 @@
+/**
+ * @file    diff_templates.cpp
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Differential checks of the C++17 templates.
+ * @license MIT
+ *
+ * @details
+ * Built into `clib_diff` (and the fuzz target) when a C++17 compiler is
+ * available. The settle time of `clib::Debounce` is a template parameter,
+ * so a fixed set of values is instantiated, including 0 (no clock).
+ */
+
+#include "diff_harness.h"
+#include "diff_reference.h"
+
+#include <cstdint>
+
+#include "edge_detector.hpp"
+#include "debounce.hpp"
+
+namespace {
+
+std::uint32_t callback_edges;
+std::uint32_t callback_changes;
+
+void count_edge(EdgeType) { ++callback_edges; }
+void count_change(bool) { ++callback_changes; }
+
+template <std::uint32_t Settle>
+void check_debounce(const DiffCase *c, const std::uint8_t *samples, const std::uint32_t *ts,
+                    std::uint32_t t0, std::size_t n, const char *name)
+{
+    clib::Debounce<Settle, clib::Callback<&count_change>> deb(c->initial != 0u, t0);
+    RefDebounce ref;
+    RefEdge changes;
+    ref_debounce_init(&ref, Settle, c->initial, t0);
+    ref_edge_init(&changes, c->initial);
+    callback_changes = 0u;
+
+    for (std::size_t i = 0; i < n; i++) {
+        std::uint8_t expected = ref_debounce_update(&ref, samples[i], ts[i]);
+        ref_edge_update(&changes, expected);
+        std::uint8_t actual = deb.update(samples[i] != 0u, ts[i]) ? 1u : 0u;
+        if (expected != actual) diff_report(name, i, expected, actual);
+    }
+    if (changes.rises + changes.falls != callback_changes)
+        diff_report(name, n, changes.rises + changes.falls, callback_changes);
+}
+
+} // namespace
+
+extern "C" void diff_check_templates(const DiffCase *c, const std::uint8_t *samples, const std::uint32_t *ts)
+{
+    std::size_t n = c->nbits < DIFF_MAX_SAMPLES ? c->nbits : DIFF_MAX_SAMPLES;
+    std::uint32_t t0 = n ? ts[0] - 1u : 0u;
+
+    clib::EdgeDetector<> counting(c->initial != 0u);
+    clib::EdgeDetector<clib::NoCounters, clib::Callback<&count_edge>> calling(c->initial != 0u);
+    RefEdge ref;
+    ref_edge_init(&ref, c->initial);
+    callback_edges = 0u;
+
+    for (std::size_t i = 0; i < n; i++) {
+        int expected = ref_edge_update(&ref, samples[i]);
+        EdgeType a = counting.update(samples[i] != 0u);
+        bool b = calling.both(samples[i] != 0u);
+        if (expected != a) diff_report("clib::EdgeDetector<>::update", i, expected, a);
+        if ((expected != REF_NONE) != b) diff_report("clib::EdgeDetector<NoCounters>::both", i, expected != REF_NONE, b);
+    }
+    if (ref.rises != counting.rise_count()) diff_report("clib::EdgeDetector<>::rise_count", n, ref.rises, counting.rise_count());
+    if (ref.falls != counting.fall_count()) diff_report("clib::EdgeDetector<>::fall_count", n, ref.falls, counting.fall_count());
+    if (ref.rises + ref.falls != callback_edges)
+        diff_report("clib::EdgeDetector<> callback", n, ref.rises + ref.falls, callback_edges);
+
+    check_debounce<0u>(c, samples, ts, t0, n, "clib::Debounce<0>");
+    check_debounce<1u>(c, samples, ts, t0, n, "clib::Debounce<1>");
+    check_debounce<5u>(c, samples, ts, t0, n, "clib::Debounce<5>");
+    check_debounce<200u>(c, samples, ts, t0, n, "clib::Debounce<200>");
+}
@@ -0,0 +1,221 @@
+/**
+ * @file    trace_replay.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Implementation of the trace replay library.
+ * @license MIT
+ *
+ * @details
+ * Frames are read directly from the mapping. Byte-per-sample frames are
+ * turned into port words 8 channels at a time with a SWAR "non-zero byte"
+ * test and a multiply that gathers the 8 flags into one byte.
+ */
+
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "trace_replay.h"
+#include "../Edge Detector/edge_detector.h"
+#include "../Common/bit_ops.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+uint8_t trace_map_open(TraceMap *map, const char *path)
+{
+    if (!map || !path) return 0u;
+    map->data = 0;
+    map->size = 0u;
+    map->fd = open(path, O_RDONLY);
+    if (map->fd < 0) return 0u;
+
+    struct stat st;
+    if (fstat(map->fd, &st) != 0 || (uint64_t)st.st_size > (uint64_t)SIZE_MAX) {
+        trace_map_close(map);
+        return 0u;
+    }
+    map->size = (size_t)st.st_size;
+    if (map->size == 0u) return 1u; /* Empty trace, nothing to map */
+
+    void *p = mmap(0, map->size, PROT_READ, MAP_PRIVATE, map->fd, 0);
+    if (p == MAP_FAILED) {
+        map->size = 0u;
+        trace_map_close(map);
+        return 0u;
+    }
+    posix_madvise(p, map->size, POSIX_MADV_SEQUENTIAL);
+    map->data = (const uint8_t *)p;
+    return 1u;
+}
+
+void trace_map_close(TraceMap *map)
+{
+    if (!map) return;
+    if (map->data) munmap((void *)map->data, map->size);
+    if (map->fd >= 0) close(map->fd);
+    map->data = 0;
+    map->size = 0u;
+    map->fd = -1;
+}
+
+size_t trace_frame_bytes(TraceFormat format, uint32_t channels)
+{
+    return (format == TRACE_FORMAT_PACKED) ? ((size_t)channels + 7u) / 8u : (size_t)channels;
+}
+
+uint8_t trace_replay_init(TraceReplay *r, TraceFormat format, EdgeArray *raw,
+                          DebouncePort *ports, EdgeArray *debounced, uint8_t debounce_samples)
+{
+    if (!r || !raw || !raw->channels) return 0u;
+    if (ports && (!debounced || debounced->channels != raw->channels)) return 0u;
+
+    r->raw = raw;
+    r->debounced = ports ? debounced : 0;
+    r->ports = ports;
+    r->frames = 0u;
+    r->channels = raw->channels;
+    r->format = format;
+    r->debounce_samples = debounce_samples;
+    return 1u;
+}
+
+/**
+ * @brief A single-channel trace is one plain sample stream.
+ */
+static inline uint8_t _trace_is_single(const TraceReplay *r)
+{
+    return (uint8_t)(r->channels == 1u);
+}
+
+size_t trace_replay_max_piece(const TraceReplay *r)
+{
+    if (!r) return 0u;
+    /* A single-channel packed trace is a plain bit stream, not padded frames. */
+    if (_trace_is_single(r) && r->format == TRACE_FORMAT_PACKED)
+        return (size_t)(TRACE_REPLAY_MAX_FRAMES / 8u);
+
+    size_t frame_bytes = trace_frame_bytes(r->format, r->channels);
+    if (frame_bytes > SIZE_MAX / TRACE_REPLAY_MAX_FRAMES)
+        return (SIZE_MAX / frame_bytes) * frame_bytes;
+    return (size_t)TRACE_REPLAY_MAX_FRAMES * frame_bytes;
+}
+
+/**
+ * @brief Port word of channels 64*word.. of one frame.
+ */
+static inline uint64_t _trace_gather(const TraceReplay *r, const uint8_t *frame, uint32_t word)
+{
+    uint32_t first = word * 64u;
+    uint32_t n = r->channels - first;
+    if (n > 64u) n = 64u;
+
+    if (r->format == TRACE_FORMAT_PACKED)
+        return bit_load_le64(frame + first / 8u, (n + 7u) / 8u);
+
+    uint64_t bits = 0u;
+    for (uint32_t i = 0; i < n; i += 8u) {
+        unsigned len = (n - i < 8u) ? (unsigned)(n - i) : 8u;
+        uint64_t x = bit_load_le64(frame + first + i, len);
+        /* 0x01 in every non-zero byte, then gather the 8 flags */
+        uint64_t nz = (((x & 0x7F7F7F7F7F7F7F7Full) + 0x7F7F7F7F7F7F7F7Full) | x) >> 7;
+        nz &= 0x0101010101010101ull;
+        bits |= ((nz * 0x0102040810204080ull) >> 56) << i;
+    }
+    return bits;
+}
+
+/**
+ * @brief Single channel: the whole piece is one bulk call.
+ *
+ * The bulk call counts in a local detector and adds the result to the
+ * array's counters, bypassing `edge_array_update()`. When the array has a
+ * callback or an EdgeRate attached, or the samples are debounced, they go
+ * through the array API one by one instead, so those hooks see every edge
+ * and the port sees every sample.
+ */
+static uint64_t _trace_run_single(TraceReplay *r, const uint8_t *data, size_t size)
+{
+    EdgeArray *raw = r->raw;
+    uint8_t packed = (r->format == TRACE_FORMAT_PACKED);
+    size_t samples = packed ? size * 8u : size; /* size <= max piece: no overflow */
+    EdgeDetector det;
+
+    if (raw->on_edge || raw->rate || r->ports) {
+        size_t i = 0u;
+        if (r->frames == 0u) {
+            uint8_t bit = packed ? (uint8_t)(data[0] & 1u) : (uint8_t)(data[0] != 0u);
+            edge_array_set_word(raw, 0u, bit);
+            if (r->ports) {
+                debounce_port_init(&r->ports[0], r->debounce_samples, bit);
+                edge_array_set_word(r->debounced, 0u, bit);
+            }
+            i = 1u;
+        }
+        for (; i < samples; i++) {
+            uint8_t bit = packed ? (uint8_t)((data[i / 8u] >> (i % 8u)) & 1u) : (uint8_t)(data[i] != 0u);
+            edge_array_update(raw, 0u, bit);
+            if (r->ports)
+                edge_array_update_word(r->debounced, 0u, debounce_port_update(&r->ports[0], bit));
+        }
+        r->frames += samples;
+        return samples;
+    }
+
+    /* The first sample only synchronizes the detector */
+    uint8_t first = packed ? (uint8_t)(data[0] & 1u) : (uint8_t)(data[0] != 0u);
+    edge_init(&det, r->frames ? (uint8_t)(raw->prev[0] & 1u) : first);
+
+    if (packed) edge_update_packed(&det, data, samples, 0, 0);
+    else        edge_update_buffer(&det, data, samples, 0, 0);
+
+    /* At most TRACE_REPLAY_MAX_FRAMES edges: the detector counts fit 32 bits */
+    raw->rise_count[0] += (uint32_t)det.rise_count;
+    raw->fall_count[0] += (uint32_t)det.fall_count;
+    raw->prev[0] = det.prev;
+    r->frames += samples;
+    return samples;
+}
+
+uint64_t trace_replay_run(TraceReplay *r, const uint8_t *data, size_t size)
+{
+    if (!r || !data || !size) return 0u;
+
+    size_t piece = trace_replay_max_piece(r);
+    if (size > piece) size = piece;
+    if (_trace_is_single(r))
+        return _trace_run_single(r, data, size);
+
+    size_t frame_bytes = trace_frame_bytes(r->format, r->channels);
+    size_t frames = size / frame_bytes;
+    uint32_t words = EDGE_ARRAY_WORDS(r->channels);
+    size_t f = 0u;
+
+    if (frames && r->frames == 0u) {
+        for (uint32_t w = 0; w < words; w++) {
+            uint64_t sample = _trace_gather(r, data, w);
+            edge_array_set_word(r->raw, w, sample);
+            if (r->ports) {
+                debounce_port_init(&r->ports[w], r->debounce_samples, sample);
+                edge_array_set_word(r->debounced, w, sample);
+            }
+        }
+        f = 1u;
+    }
+
+    for (; f < frames; f++) {
+        const uint8_t *frame = data + f * frame_bytes;
+        for (uint32_t w = 0; w < words; w++) {
+            uint64_t sample = _trace_gather(r, frame, w);
+            edge_array_update_word(r->raw, w, sample);
+            if (r->ports)
+                edge_array_update_word(r->debounced, w, debounce_port_update(&r->ports[w], sample));
+        }
+    }
+
+    r->frames += frames;
+    return frames;
+}
@@ -0,0 +1,169 @@
+/**
+ * @file    trace_replay.h
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Zero-copy replay of recorded logic traces through the bulk APIs.
+ * @license MIT
+ *
+ * @details
+ * A trace is a flat binary file of frames, one frame per time step, with
+ * the channels interleaved inside the frame:
+ * - TRACE_FORMAT_BYTES:  one byte per channel (non-zero = high),
+ * - TRACE_FORMAT_PACKED: one bit per channel, LSB-first
+ *   (channel c is bit c % 8 of byte c / 8), frames padded to whole bytes.
+ *   A single-channel packed trace is a plain LSB-first bit stream
+ *   (8 samples per byte), as used by `edge_update_packed()`, with or
+ *   without debouncing.
+ *
+ * `trace_map_open()` memory-maps the file read-only, so traces of many
+ * gigabytes are streamed by the page cache instead of being loaded into
+ * RAM, and `trace_replay_run()` consumes the mapping in place:
+ * - single-channel traces without debouncing or hooks go straight through
+ *   `edge_update_buffer()` / `edge_update_packed()`; with them, sample by
+ *   sample through the array (and the channel's DebouncePort),
+ * - multi-channel traces are gathered 64 channels at a time into port
+ *   words for an EdgeArray, with an optional DebouncePort per word and a
+ *   second EdgeArray counting the debounced transitions.
+ *
+ * The first frame only synchronizes the state (as `edge_init()` would);
+ * edges are counted from the second frame on. State storage is provided by
+ * the caller, as everywhere in the library.
+ *
+ * The EdgeArray counters are 32 bits wide. One call consumes at most
+ * TRACE_REPLAY_MAX_FRAMES frames, so a caller that drains the counters into
+ * wider totals after every call (and resets the arrays) never loses edges:
+ * @code
+ * size_t piece = trace_replay_max_piece(&replay);
+ * for (size_t off = 0; off < map.size; off += piece) {
+ *     trace_replay_run(&replay, map.data + off, (map.size - off < piece) ? map.size - off : piece);
+ *     ... add the counters to uint64_t totals, edge_array_reset() ...
+ * }
+ * @endcode
+ */
+
+#ifndef TRACE_REPLAY_H
+#define TRACE_REPLAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../Edge Detector/edge_array.h"
+#include "../Debounce Signal/debounce_port.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Frames consumed by one `trace_replay_run()` call at most (2^31). */
+#define TRACE_REPLAY_MAX_FRAMES 0x80000000u
+
+/**
+ * @enum TraceFormat
+ * @brief Sample encoding of a trace.
+ */
+typedef enum {
+    TRACE_FORMAT_BYTES = 0,     /**< One byte per channel and frame. */
+    TRACE_FORMAT_PACKED         /**< One bit per channel, frames padded to bytes. */
+} TraceFormat;
+
+/**
+ * @struct TraceMap
+ * @brief Read-only memory mapping of a trace file.
+ */
+typedef struct {
+    const uint8_t *data;    /**< First byte of the file. */
+    size_t size;            /**< File size in bytes. */
+    int fd;                 /**< File descriptor, -1 when closed. */
+} TraceMap;
+
+/**
+ * @struct TraceReplay
+ * @brief Replay state of one trace.
+ *
+ * @var TraceReplay::raw
+ *      Edges of the raw samples (required).
+ * @var TraceReplay::debounced
+ *      Edges of the debounced samples, or NULL without debouncing.
+ * @var TraceReplay::ports
+ *      One DebouncePort per word of `raw`, or NULL without debouncing.
+ * @var TraceReplay::frames
+ *      Frames consumed so far.
+ * @var TraceReplay::channels
+ *      Channels per frame.
+ * @var TraceReplay::format
+ *      Sample encoding.
+ * @var TraceReplay::debounce_samples
+ *      Sample count given to the DebouncePorts.
+ */
+typedef struct {
+    EdgeArray *raw;
+    EdgeArray *debounced;
+    DebouncePort *ports;
+    uint64_t frames;
+    uint32_t channels;
+    TraceFormat format;
+    uint8_t debounce_samples;
+} TraceReplay;
+
+/**
+ * @brief Maps a trace file read-only.
+ * @param map Pointer to the TraceMap instance.
+ * @param path File name.
+ * @return 1 on success, 0 if the file cannot be opened or mapped.
+ */
+uint8_t trace_map_open(TraceMap *map, const char *path);
+
+/**
+ * @brief Unmaps and closes a trace file.
+ * @param map Pointer to the TraceMap instance.
+ */
+void trace_map_close(TraceMap *map);
+
+/**
+ * @brief Returns the size of one frame in bytes.
+ * @param format Sample encoding.
+ * @param channels Channels per frame.
+ */
+size_t trace_frame_bytes(TraceFormat format, uint32_t channels);
+
+/**
+ * @brief Initializes a replay over caller-provided state.
+ * @param r Pointer to the TraceReplay instance.
+ * @param format Sample encoding.
+ * @param raw EdgeArray of `channels` channels for the raw edges.
+ * @param ports EDGE_ARRAY_WORDS(channels) DebouncePorts, or NULL.
+ * @param debounced EdgeArray of `channels` channels for the debounced
+ *                  edges, or NULL (required when `ports` is given).
+ * @param debounce_samples Sample count of the debounce stage.
+ * @return 1 on success, 0 on inconsistent arguments.
+ */
+uint8_t trace_replay_init(TraceReplay *r, TraceFormat format, EdgeArray *raw,
+                          DebouncePort *ports, EdgeArray *debounced, uint8_t debounce_samples);
+
+/**
+ * @brief Size in bytes of the largest piece `trace_replay_run()` consumes.
+ * @param r Pointer to the initialized TraceReplay instance.
+ * @return A whole number of frames, at most TRACE_REPLAY_MAX_FRAMES.
+ */
+size_t trace_replay_max_piece(const TraceReplay *r);
+
+/**
+ * @brief Replays whole frames from a buffer (typically a TraceMap).
+ * @param r Pointer to the TraceReplay instance.
+ * @param data Frame data.
+ * @param size Size of `data` in bytes; a trailing partial frame is ignored,
+ *             and so is anything beyond `trace_replay_max_piece()` bytes.
+ * @return Number of frames consumed.
+ *
+ * @details
+ * Can be called repeatedly on consecutive pieces of a trace as long as
+ * every piece holds whole frames.
+ */
+uint64_t trace_replay_run(TraceReplay *r, const uint8_t *data, size_t size);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* TRACE_REPLAY_H */
@@ -0,0 +1,129 @@
+/**
+ * @file    trace_replay_main.c
+ * @author  Radmehr Moradkhani
+ * @version 1.0
+ * @date    2026-10-14
+ * @brief   Command-line front end of the trace replay library.
+ * @license MIT
+ *
+ * @details
+ * Usage:
+ * @code
+ * trace_replay [-f bytes|packed] [-c channels] [-d samples] [-s skip] trace.bin
+ * @endcode
+ * - `-f` sample encoding (default `bytes`),
+ * - `-c` channels per frame (default 1),
+ * - `-d` debounce sample count, 0 disables the debounce stage (default 0),
+ * - `-s` bytes of file header to skip (default 0).
+ *
+ * Prints one CSV line per channel (`channel,rises,falls,deb_rises,deb_falls`)
+ * to stdout and a summary to stderr. The trace is replayed in pieces of
+ * `trace_replay_max_piece()` bytes; after each piece the 32-bit counters
+ * are drained into 64-bit totals, so long traces do not wrap them.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace_replay.h"
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: trace_replay [-f bytes|packed] [-c channels] "
+                    "[-d samples] [-s skip] trace.bin\n");
+}
+
+int main(int argc, char **argv)
+{
+    TraceFormat format = TRACE_FORMAT_BYTES;
+    unsigned long channels = 1u;
+    unsigned long debounce = 0u;
+    unsigned long skip = 0u;
+    const char *path = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            const char *f = argv[++i];
+            if (strcmp(f, "bytes") == 0)       format = TRACE_FORMAT_BYTES;
+            else if (strcmp(f, "packed") == 0) format = TRACE_FORMAT_PACKED;
+            else { usage(); return 2; }
+        }
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) channels = strtoul(argv[++i], 0, 0);
+        else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) debounce = strtoul(argv[++i], 0, 0);
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) skip = strtoul(argv[++i], 0, 0);
+        else if (argv[i][0] != '-' && !path) path = argv[i];
+        else { usage(); return 2; }
+    }
+    if (!path || channels == 0u || channels > UINT32_MAX || debounce > 255u) {
+        usage();
+        return 2;
+    }
+
+    TraceMap map;
+    if (!trace_map_open(&map, path)) {
+        fprintf(stderr, "trace_replay: cannot map %s\n", path);
+        return 1;
+    }
+    if (skip > map.size) skip = map.size;
+
+    /* Host tool: state is sized from the command line */
+    uint32_t n = (uint32_t)channels;
+    uint32_t words = EDGE_ARRAY_WORDS(n);
+    uint64_t *prev = calloc(2u * words, sizeof(uint64_t));
+    uint32_t *counts = calloc(4u * (size_t)n, sizeof(uint32_t));
+    uint64_t *totals = calloc(4u * (size_t)n, sizeof(uint64_t));
+    DebouncePort *ports = debounce ? calloc(words, sizeof(DebouncePort)) : 0;
+    int status = 1;
+    if (!prev || !counts || !totals || (debounce && !ports)) {
+        fprintf(stderr, "trace_replay: out of memory\n");
+        goto done;
+    }
+
+    EdgeArray raw, deb;
+    TraceReplay replay;
+    edge_array_init(&raw, prev, counts, counts + n, n);
+    edge_array_init(&deb, prev + words, counts + 2u * n, counts + 3u * n, n);
+    if (!trace_replay_init(&replay, format, &raw, ports, &deb, (uint8_t)debounce)) {
+        fprintf(stderr, "trace_replay: cannot set up the replay\n");
+        goto done;
+    }
+
+    size_t piece = trace_replay_max_piece(&replay);
+    for (size_t off = skip; off < map.size; off += piece) {
+        size_t len = (map.size - off < piece) ? map.size - off : piece;
+        trace_replay_run(&replay, map.data + off, len);
+        for (size_t i = 0; i < 4u * (size_t)n; i++)
+            totals[i] += counts[i];
+        edge_array_reset(&raw);
+        edge_array_reset(&deb);
+    }
+
+    uint64_t rises = 0u, falls = 0u, deb_rises = 0u, deb_falls = 0u;
+    printf("channel,rises,falls,deb_rises,deb_falls\n");
+    for (uint32_t c = 0; c < n; c++) {
+        uint64_t r = totals[c], f = totals[n + c];
+        uint64_t dr = totals[2u * n + c], df = totals[3u * n + c];
+        printf("%u,%llu,%llu,%llu,%llu\n", (unsigned)c, (unsigned long long)r,
+               (unsigned long long)f, (unsigned long long)dr, (unsigned long long)df);
+        rises += r;
+        falls += f;
+        deb_rises += dr;
+        deb_falls += df;
+    }
+    fprintf(stderr, "trace_replay: %llu frames, %u channels, %llu/%llu raw edges, "
+                    "%llu/%llu debounced edges (rise/fall)\n",
+            (unsigned long long)replay.frames, (unsigned)n,
+            (unsigned long long)rises, (unsigned long long)falls,
+            (unsigned long long)deb_rises, (unsigned long long)deb_falls);
+
+    status = 0;
+
+done:
+    free(ports);
+    free(totals);
+    free(counts);
+    free(prev);
+    trace_map_close(&map);
+    return status;
+}